@@ -0,0 +1,144 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <random>
+
+// Number of steps recorded (and then replayed) by each benchmark
+static constexpr ssize_t BENCH_NUM_STEPS = 500;
+
+// Path of the recording shared by the replay benchmarks (written once per number of bodies)
+static std::string GetBenchRecordingPath( ssize_t num_bodies )
+{
+    return "./bench_recording_" + std::to_string( num_bodies ) + ".bin";
+}
+
+// Creates a scenario with a ground plane and the given number of boxes stacked in columns above it
+static std::unique_ptr<loco::TScenario> CreateBenchScenario( ssize_t num_bodies )
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+
+    auto plane_data = loco::TBodyData();
+    plane_data.dyntype = loco::eDynamicsType::STATIC;
+    plane_data.collision.type = loco::eShapeType::PLANE;
+    plane_data.collision.size = { 100.0, 100.0, 1.0 };
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "ground", plane_data, tinymath::Vector3f(), tinymath::Matrix3f() ) );
+
+    for ( ssize_t i = 0; i < num_bodies; i++ )
+    {
+        auto body_data = loco::TBodyData();
+        body_data.dyntype = loco::eDynamicsType::DYNAMIC;
+        body_data.collision.type = loco::eShapeType::BOX;
+        body_data.collision.size = { 0.2, 0.2, 0.2 };
+        const auto position = tinymath::Vector3f( 0.5f * ( i % 10 ), 0.5f * ( ( i / 10 ) % 10 ), 0.5f + 0.25f * ( i / 100 ) );
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "body_" + std::to_string( i ), body_data, position, tinymath::Matrix3f() ) );
+    }
+    return scenario;
+}
+
+// Simulates (and records) the episode, which is the baseline for its replay
+static void BM_Simulate( benchmark::State& state )
+{
+    auto scenario = CreateBenchScenario( state.range( 0 ) );
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    for ( auto _ : state )
+    {
+        state.PauseTiming();
+        simulation->Reset();
+        simulation->StartRecording( GetBenchRecordingPath( state.range( 0 ) ) );
+        state.ResumeTiming();
+        for ( ssize_t i = 0; i < BENCH_NUM_STEPS; i++ )
+            simulation->Step();
+        state.PauseTiming();
+        simulation->StopRecording();
+        state.ResumeTiming();
+    }
+    state.counters["steps/s"] = benchmark::Counter( state.iterations() * BENCH_NUM_STEPS, benchmark::Counter::kIsRate );
+    state.counters["bytes/frame"] = simulation->recorder()->frames_bytes() / double( BENCH_NUM_STEPS );
+}
+
+// Simulates the episode recording quantized frames, to compare the size of the recording against the raw one
+static void BM_SimulateQuantized( benchmark::State& state )
+{
+    auto scenario = CreateBenchScenario( state.range( 0 ) );
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    auto compression = loco::raisimlib::TRaisimRecordingCompression();
+    compression.codec = loco::raisimlib::eRaisimRecordingCodec::QUANTIZED;
+    const auto recording_path = GetBenchRecordingPath( state.range( 0 ) ) + ".quantized";
+    for ( auto _ : state )
+    {
+        state.PauseTiming();
+        simulation->Reset();
+        simulation->StartRecording( recording_path, false, compression );
+        state.ResumeTiming();
+        for ( ssize_t i = 0; i < BENCH_NUM_STEPS; i++ )
+            simulation->Step();
+        state.PauseTiming();
+        simulation->StopRecording();
+        state.ResumeTiming();
+    }
+    state.counters["steps/s"] = benchmark::Counter( state.iterations() * BENCH_NUM_STEPS, benchmark::Counter::kIsRate );
+    state.counters["bytes/frame"] = simulation->recorder()->frames_bytes() / double( BENCH_NUM_STEPS );
+    std::remove( recording_path.c_str() );
+}
+
+// Replays the recorded episode in order (no integration, just pose writes)
+static void BM_Replay( benchmark::State& state )
+{
+    auto scenario = CreateBenchScenario( state.range( 0 ) );
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    if ( !simulation->StartReplay( GetBenchRecordingPath( state.range( 0 ) ) ) )
+    {
+        state.SkipWithError( "couldn't open the recording (BM_Simulate must run first)" );
+        return;
+    }
+    for ( auto _ : state )
+    {
+        simulation->SeekReplay( 0 );
+        for ( ssize_t i = 0; i < BENCH_NUM_STEPS; i++ )
+            simulation->Step();
+    }
+    state.counters["steps/s"] = benchmark::Counter( state.iterations() * BENCH_NUM_STEPS, benchmark::Counter::kIsRate );
+}
+
+// Jumps to random frames of the recorded episode
+static void BM_ReplaySeek( benchmark::State& state )
+{
+    auto scenario = CreateBenchScenario( state.range( 0 ) );
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    if ( !simulation->StartReplay( GetBenchRecordingPath( state.range( 0 ) ) ) )
+    {
+        state.SkipWithError( "couldn't open the recording (BM_Simulate must run first)" );
+        return;
+    }
+    auto random_engine = std::mt19937( 0 );
+    auto random_frame = std::uniform_int_distribution<ssize_t>( 0, simulation->replayer()->num_frames() - 1 );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( simulation->SeekReplay( random_frame( random_engine ) ) );
+    simulation->StopReplay();
+    std::remove( GetBenchRecordingPath( state.range( 0 ) ).c_str() );
+}
+
+BENCHMARK( BM_Simulate )
+    ->ArgName( "bodies" )
+    ->Arg( 10 )->Arg( 100 )->Arg( 1000 )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_SimulateQuantized )
+    ->ArgName( "bodies" )
+    ->Arg( 10 )->Arg( 100 )->Arg( 1000 )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_Replay )
+    ->ArgName( "bodies" )
+    ->Arg( 10 )->Arg( 100 )->Arg( 1000 )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_ReplaySeek )
+    ->ArgName( "bodies" )
+    ->Arg( 10 )->Arg( 100 )->Arg( 1000 )
+    ->Unit( benchmark::kMicrosecond );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+
+// Path of the precompiled scene shared by all benchmarks (written once per number of bodies)
+static std::string GetBenchScenePath( ssize_t num_bodies )
+{
+    return "./bench_scene_" + std::to_string( num_bodies ) + ".bin";
+}
+
+// Creates a scenario whose bodies require preprocessing on each build: meshes (inertia from their AABB),
+// large heightfields (rescaled heights) and primitives (volume-based masses)
+static std::unique_ptr<loco::TScenario> CreateBenchScenario( ssize_t num_bodies )
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+    for ( ssize_t i = 0; i < num_bodies; i++ )
+    {
+        auto body_data = loco::TBodyData();
+        body_data.dyntype = loco::eDynamicsType::DYNAMIC;
+        body_data.visual = loco::TVisualData();
+        switch ( i % 3 )
+        {
+            case 0 :
+            {
+                body_data.collision.type = loco::eShapeType::BOX;
+                body_data.collision.size = { 0.2, 0.2, 0.2 };
+                break;
+            }
+            case 1 :
+            {
+                body_data.collision.type = loco::eShapeType::MESH;
+                body_data.collision.size = { 0.2, 0.2, 0.2 };
+                body_data.collision.mesh_data.filename = loco::PATH_RESOURCES + "meshes/monkey.stl";
+                break;
+            }
+            case 2 :
+            {
+                body_data.dyntype = loco::eDynamicsType::STATIC;
+                body_data.collision.type = loco::eShapeType::HFIELD;
+                body_data.collision.size = { 10.0, 10.0, 1.0 };
+                body_data.collision.hfield_data.nWidthSamples = 256;
+                body_data.collision.hfield_data.nDepthSamples = 256;
+                for ( ssize_t j = 0; j < 256 * 256; j++ )
+                    body_data.collision.hfield_data.heights.push_back( 0.5f + 0.5f * std::sin( 0.01f * j ) );
+                break;
+            }
+        }
+        const auto position = tinymath::Vector3f( 0.5f * i, 0.0f, 1.0f );
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "body_" + std::to_string( i ), body_data, position, tinymath::Matrix3f() ) );
+    }
+    return scenario;
+}
+
+// Builds a world from scratch (all preprocessing included), which is the baseline for the precompiled load
+static void BM_BuildCold( benchmark::State& state )
+{
+    for ( auto _ : state )
+    {
+        state.PauseTiming();
+        auto scenario = CreateBenchScenario( state.range( 0 ) );
+        state.ResumeTiming();
+        auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+        simulation->Initialize();
+        benchmark::DoNotOptimize( simulation->raisim_world() );
+    }
+}
+
+// Builds a world from its precompiled scene (mmap'ed, so opening the file is part of the measured time)
+static void BM_BuildPrecompiled( benchmark::State& state )
+{
+    {
+        auto scenario = CreateBenchScenario( state.range( 0 ) );
+        auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+        simulation->Initialize();
+        if ( !simulation->SavePrecompiledScene( GetBenchScenePath( state.range( 0 ) ) ) )
+        {
+            state.SkipWithError( "couldn't save the precompiled scene" );
+            return;
+        }
+    }
+
+    for ( auto _ : state )
+    {
+        state.PauseTiming();
+        auto scenario = CreateBenchScenario( state.range( 0 ) );
+        state.ResumeTiming();
+        auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+        simulation->LoadPrecompiledScene( GetBenchScenePath( state.range( 0 ) ) );
+        simulation->Initialize();
+        benchmark::DoNotOptimize( simulation->raisim_world() );
+    }
+    std::remove( GetBenchScenePath( state.range( 0 ) ).c_str() );
+}
+
+BENCHMARK( BM_BuildCold )
+    ->ArgName( "bodies" )
+    ->Arg( 3 )->Arg( 30 )->Arg( 300 )
+    ->Unit( benchmark::kMillisecond );
+BENCHMARK( BM_BuildPrecompiled )
+    ->ArgName( "bodies" )
+    ->Arg( 3 )->Arg( 30 )->Arg( 300 )
+    ->Unit( benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
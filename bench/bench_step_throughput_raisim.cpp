@@ -0,0 +1,181 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <loco_parallel_raisim.h>
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <fstream>
+#include <unistd.h>
+
+// Shape-mixes used by the benchmarks: a single shape type each, or all of them (round-robin). For the HFIELD
+// mix the bodies (primitives, round-robin) are dropped onto a single heightfield terrain, which the MIXED mix
+// also includes under its bodies
+enum class eBenchShapeMix
+{
+    BOX = 0, SPHERE, CAPSULE, MESH, HFIELD, MIXED
+};
+
+static const std::vector<loco::eShapeType> BENCH_SHAPES = { loco::eShapeType::BOX,
+                                                            loco::eShapeType::SPHERE,
+                                                            loco::eShapeType::CAPSULE,
+                                                            loco::eShapeType::MESH };
+
+static const std::vector<loco::eShapeType> BENCH_PRIMITIVE_SHAPES = { loco::eShapeType::BOX,
+                                                                      loco::eShapeType::SPHERE,
+                                                                      loco::eShapeType::CAPSULE };
+
+// Resident memory of this process (in bytes), used to estimate the memory footprint of each world
+static double GetResidentMemoryBytes()
+{
+    std::ifstream statm_file( "/proc/self/statm" );
+    double total_pages = 0.0, resident_pages = 0.0;
+    if ( statm_file.is_open() )
+        statm_file >> total_pages >> resident_pages;
+    return resident_pages * sysconf( _SC_PAGESIZE );
+}
+
+static loco::TCollisionData CreateBenchCollisionData( loco::eShapeType shape )
+{
+    auto col_data = loco::TCollisionData();
+    col_data.type = shape;
+    switch ( shape )
+    {
+        case loco::eShapeType::BOX : col_data.size = { 0.2, 0.2, 0.2 }; break;
+        case loco::eShapeType::SPHERE : col_data.size = { 0.1, 0.1, 0.1 }; break;
+        case loco::eShapeType::CAPSULE : col_data.size = { 0.1, 0.2, 0.1 }; break;
+        case loco::eShapeType::MESH :
+        {
+            col_data.size = { 0.2, 0.2, 0.2 };
+            col_data.mesh_data.filename = loco::PATH_RESOURCES + "meshes/monkey.stl";
+            break;
+        }
+        default : break;
+    }
+    return col_data;
+}
+
+// Creates a bumpy heightfield terrain (centered at the origin) large enough to cover the given extent
+static loco::TCollisionData CreateBenchTerrainCollisionData( double extent )
+{
+    const ssize_t num_samples = 64;
+    auto col_data = loco::TCollisionData();
+    col_data.type = loco::eShapeType::HFIELD;
+    col_data.size = { extent, extent, 0.2 };
+    col_data.hfield_data.nWidthSamples = num_samples;
+    col_data.hfield_data.nDepthSamples = num_samples;
+    for ( ssize_t i = 0; i < num_samples; i++ )
+        for ( ssize_t j = 0; j < num_samples; j++ )
+            col_data.hfield_data.heights.push_back( 0.5f + 0.25f * ( std::sin( 0.5f * i ) + std::cos( 0.5f * j ) ) );
+    return col_data;
+}
+
+// Creates a scenario with a ground plane and the given number of dynamic bodies, laid out on a grid (centered
+// at the origin) above it. Mixes with heightfields add a single terrain under the grid, where bodies land on
+static std::unique_ptr<loco::TScenario> CreateBenchScenario( ssize_t num_bodies, eBenchShapeMix shape_mix )
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+
+    auto plane_data = loco::TBodyData();
+    plane_data.dyntype = loco::eDynamicsType::STATIC;
+    plane_data.collision.type = loco::eShapeType::PLANE;
+    plane_data.collision.size = { 100.0, 100.0, 1.0 };
+    plane_data.visual = loco::TVisualData();
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "floor", plane_data, tinymath::Vector3f( 0.0, 0.0, 0.0 ), tinymath::Matrix3f() ) );
+
+    const ssize_t grid_size = std::ceil( std::sqrt( (double)num_bodies ) );
+    const double grid_spacing = 0.5;
+    const double grid_offset = -0.5 * grid_spacing * ( grid_size - 1 );
+    if ( shape_mix == eBenchShapeMix::HFIELD || shape_mix == eBenchShapeMix::MIXED )
+    {
+        auto terrain_data = loco::TBodyData();
+        terrain_data.dyntype = loco::eDynamicsType::STATIC;
+        terrain_data.collision = CreateBenchTerrainCollisionData( grid_spacing * grid_size + 2.0 );
+        terrain_data.visual = loco::TVisualData();
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "terrain", terrain_data, tinymath::Vector3f( 0.0, 0.0, 0.0 ), tinymath::Matrix3f() ) );
+    }
+
+    for ( ssize_t i = 0; i < num_bodies; i++ )
+    {
+        loco::eShapeType shape;
+        if ( shape_mix == eBenchShapeMix::MIXED )
+            shape = BENCH_SHAPES[i % BENCH_SHAPES.size()];
+        else if ( shape_mix == eBenchShapeMix::HFIELD )
+            shape = BENCH_PRIMITIVE_SHAPES[i % BENCH_PRIMITIVE_SHAPES.size()];
+        else
+            shape = BENCH_SHAPES[(int)shape_mix];
+
+        auto body_data = loco::TBodyData();
+        body_data.dyntype = loco::eDynamicsType::DYNAMIC;
+        body_data.collision = CreateBenchCollisionData( shape );
+        body_data.visual = loco::TVisualData();
+
+        const auto position = tinymath::Vector3f( grid_offset + grid_spacing * ( i % grid_size ),
+                                                  grid_offset + grid_spacing * ( i / grid_size ), 1.0f );
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "body_" + std::to_string( i ), body_data, position, tinymath::Matrix3f() ) );
+    }
+    return scenario;
+}
+
+// A vectorized set of independent worlds, each one with its own scenario and simulation
+struct TBenchWorlds
+{
+    std::vector<std::unique_ptr<loco::TScenario>> scenarios;
+    std::vector<std::unique_ptr<loco::raisimlib::TRaisimSimulation>> simulations;
+    double memory_per_world;
+};
+
+static void CreateBenchWorlds( TBenchWorlds& worlds, ssize_t num_worlds, ssize_t num_bodies, eBenchShapeMix shape_mix )
+{
+    const double memory_before = GetResidentMemoryBytes();
+    for ( ssize_t i = 0; i < num_worlds; i++ )
+    {
+        worlds.scenarios.push_back( CreateBenchScenario( num_bodies, shape_mix ) );
+        worlds.simulations.push_back( std::make_unique<loco::raisimlib::TRaisimSimulation>( worlds.scenarios.back().get() ) );
+        worlds.simulations.back()->Initialize();
+    }
+    worlds.memory_per_world = ( GetResidentMemoryBytes() - memory_before ) / num_worlds;
+}
+
+static void RunBenchSteps( benchmark::State& state, ssize_t num_bodies, eBenchShapeMix shape_mix, ssize_t num_worlds, ssize_t num_threads )
+{
+    TBenchWorlds worlds;
+    CreateBenchWorlds( worlds, num_worlds, num_bodies, shape_mix );
+    loco::raisimlib::TRaisimThreadPool thread_pool( num_threads );
+
+    const double world_time_start = worlds.simulations.front()->raisim_world()->getWorldTime();
+    for ( auto _ : state )
+        thread_pool.ParallelFor( num_worlds, [&]( ssize_t i ) { worlds.simulations[i]->Step(); } );
+
+    // Each step runs several raisim substeps (integrate calls), so also report the cost per substep
+    auto raisim_world = worlds.simulations.front()->raisim_world();
+    const double num_substeps_per_world = ( raisim_world->getWorldTime() - world_time_start ) / raisim_world->getTimeStep();
+    const double num_substeps = num_substeps_per_world * num_worlds;
+    state.counters["steps_per_sec"] = benchmark::Counter( state.iterations() * num_worlds, benchmark::Counter::kIsRate );
+    state.counters["ns_per_substep"] = benchmark::Counter( num_substeps / 1e9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert );
+    state.counters["mem_per_world_kb"] = worlds.memory_per_world / 1024.0;
+    state.counters["num_objs_per_world"] = raisim_world->getObjList().size();
+}
+
+// Sweeps the number of bodies for each shape-mix (single world, single thread)
+static void BM_StepBodies( benchmark::State& state )
+{
+    RunBenchSteps( state, state.range( 0 ), (eBenchShapeMix)state.range( 1 ), 1, 1 );
+}
+BENCHMARK( BM_StepBodies )
+    ->ArgNames( { "bodies", "shape_mix" } )
+    ->ArgsProduct( { { 1, 10, 100, 1000, 10000 }, { 0, 1, 2, 3, 4, 5 } } )
+    ->Unit( benchmark::kMicrosecond )
+    ->UseRealTime();
+
+// Sweeps the number of worlds and threads (mixed shapes, fixed number of bodies per world)
+static void BM_StepWorlds( benchmark::State& state )
+{
+    RunBenchSteps( state, 100, eBenchShapeMix::MIXED, state.range( 0 ), state.range( 1 ) );
+}
+BENCHMARK( BM_StepWorlds )
+    ->ArgNames( { "worlds", "threads" } )
+    ->ArgsProduct( { { 1, 4, 16, 64 }, { 1, 2, 4, 8 } } )
+    ->Unit( benchmark::kMicrosecond )
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_arena_raisim.h>
+
+namespace loco {
+    class TCompound;
+}
+
+namespace loco {
+namespace raisimlib {
+
+    // Adapter that maps a loco compound (several rigidly attached colliders) into a single raisim compound
+    // object, so the solver handles it as one rigid body regardless of its number of shapes
+    class TRaisimCompoundAdapter
+    {
+    public :
+
+        TRaisimCompoundAdapter( TCompound* compound_ref );
+
+        TRaisimCompoundAdapter( const TRaisimCompoundAdapter& other ) = delete;
+
+        TRaisimCompoundAdapter& operator=( const TRaisimCompoundAdapter& other ) = delete;
+
+        // Adapters are placed in the arena of the simulation that owns them
+        LOCO_RAISIM_ARENA_ALLOCATED( TRaisimCompoundAdapter )
+
+        ~TRaisimCompoundAdapter();
+
+        void Build();
+
+        void Initialize();
+
+        void Reset();
+
+        // Writes the pose of the raisim compound back into the loco compound
+        void PostStep();
+
+        void SetTransform( const TMat4& transform );
+
+        // Sets the linear velocity of the compound frame (not of the com, which also moves if the compound spins)
+        void SetLinearVelocity( const TVec3& linear_vel );
+
+        void SetAngularVelocity( const TVec3& angular_vel );
+
+        void GetTransform( TMat4& dst_transform ) const;
+
+        // Gets the linear velocity of the compound frame
+        void GetLinearVelocity( TVec3& dst_linear_vel ) const;
+
+        void GetAngularVelocity( TVec3& dst_angular_vel ) const;
+
+        void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
+
+        TCompound* compound() { return m_CompoundRef; }
+
+        const TCompound* compound() const { return m_CompoundRef; }
+
+        raisim::Compound* raisim_compound() { return m_RaisimCompoundRef; }
+
+        const raisim::Compound* raisim_compound() const { return m_RaisimCompoundRef; }
+
+        // Position of the com w.r.t. the compound frame (origin of the raisim compound's frame)
+        TVec3 local_com() const { return vec3_from_eigen( m_LocalCom ); }
+
+    private :
+
+        void _SetupInitialPose();
+
+        void _SetupInitialVelocity();
+
+        // Places the raisim compound (framed at the com) such that the compound frame ends up at the given pose
+        void _SetRaisimPose( const TMat4& transform );
+
+        // Sets the velocity of the raisim compound (at the com) such that the compound frame moves with the given velocity
+        void _SetRaisimVelocity( const Eigen::Vector3d& linear_vel, const Eigen::Vector3d& angular_vel );
+
+        // Returns the linear velocity of the compound frame (raisim tracks the velocity of the com)
+        Eigen::Vector3d _GetFrameLinearVelocity() const;
+
+    private :
+
+        // Reference to the loco compound wrapped by this adapter
+        TCompound* m_CompoundRef;
+        // Reference to the raisim-world, used to create all simulation-related objects
+        raisim::World* m_RaisimWorldRef;
+        // Reference to the compound raisim resource (owned by world)
+        raisim::Compound* m_RaisimCompoundRef;
+        // Position of the com w.r.t. the compound frame
+        Eigen::Vector3d m_LocalCom;
+    };
+
+}}
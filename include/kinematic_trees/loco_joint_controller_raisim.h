@@ -0,0 +1,57 @@
+#pragma once
+
+#include <kinematic_trees/loco_kinematic_tree_adapter_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Batched joint pd-controller for all kintrees of a simulation. Gains and targets are given as
+    // concatenated buffers (in kintree order) and handed to raisim's built-in pd-controller, which
+    // runs implicitly on every integration substep (i.e. at physics rate)
+    class TRaisimJointController
+    {
+    public :
+
+        TRaisimJointController() = default;
+
+        TRaisimJointController( const TRaisimJointController& other ) = delete;
+
+        TRaisimJointController& operator=( const TRaisimJointController& other ) = delete;
+
+        ~TRaisimJointController() = default;
+
+        // Collects the dimensions|offsets of the given (already built) kintree adapters
+        void Initialize( const std::vector<TRaisimKinematicTreeAdapter*>& kintree_adapters );
+
+        // Sets the pd-gains of all kintrees (requires total_dofs() entries each)
+        void SetGains( const double* kp, const double* kd );
+
+        // Sets the pd-targets of all kintrees (requires total_generalized_coordinates() and total_dofs()
+        // entries respectively, qd_targets can be nullptr for zero velocity-targets)
+        void SetTargets( const double* q_targets, const double* qd_targets );
+
+        ssize_t num_kintrees() const { return m_KintreeAdaptersRefs.size(); }
+
+        ssize_t total_generalized_coordinates() const { return m_TotalGeneralizedCoordinates; }
+
+        ssize_t total_dofs() const { return m_TotalDofs; }
+
+        // Offset of the i-th kintree into the concatenated generalized-coordinates buffers
+        ssize_t offset_generalized_coordinates( ssize_t index ) const { return m_OffsetsGeneralizedCoordinates[index]; }
+
+        // Offset of the i-th kintree into the concatenated dofs buffers
+        ssize_t offset_dofs( ssize_t index ) const { return m_OffsetsDofs[index]; }
+
+    private :
+
+        // References to the kintree adapters handled by this controller
+        std::vector<TRaisimKinematicTreeAdapter*> m_KintreeAdaptersRefs;
+        // Offsets of each kintree into the concatenated buffers
+        std::vector<ssize_t> m_OffsetsGeneralizedCoordinates;
+        std::vector<ssize_t> m_OffsetsDofs;
+        // Total sizes of the concatenated buffers
+        ssize_t m_TotalGeneralizedCoordinates = 0;
+        ssize_t m_TotalDofs = 0;
+    };
+
+}}
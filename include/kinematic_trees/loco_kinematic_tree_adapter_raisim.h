@@ -0,0 +1,143 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_arena_raisim.h>
+
+namespace loco {
+    class TKinematicTree;
+}
+
+namespace loco {
+namespace raisimlib {
+
+    class TRaisimKinematicTreeAdapter
+    {
+    public :
+
+        TRaisimKinematicTreeAdapter( TKinematicTree* kintree_ref );
+
+        TRaisimKinematicTreeAdapter( const TRaisimKinematicTreeAdapter& other ) = delete;
+
+        TRaisimKinematicTreeAdapter& operator=( const TRaisimKinematicTreeAdapter& other ) = delete;
+
+        // Adapters are placed in the arena of the simulation that owns them
+        LOCO_RAISIM_ARENA_ALLOCATED( TRaisimKinematicTreeAdapter )
+
+        ~TRaisimKinematicTreeAdapter();
+
+        // Creates the articulated-system from the model file given through SetModelFilepath (the kintree is left
+        // unbuilt, i.e. raisim_articulated_system() is nullptr, if there's none)
+        void Build();
+
+        void Initialize();
+
+        void Reset();
+
+        // Writes the pose of the root link back into the loco kintree
+        void PostStep();
+
+        // Urdf file the articulated-system is created from (must be set before building)
+        void SetModelFilepath( const std::string& model_filepath ) { m_ModelFilepath = model_filepath; }
+
+        const std::string& model_filepath() const { return m_ModelFilepath; }
+
+        // Writes the generalized coordinates of the kintree into dst_gc (requires num_generalized_coordinates() entries)
+        void GetGeneralizedCoordinates( double* dst_gc ) const;
+
+        // Writes the generalized velocities of the kintree into dst_gv (requires num_dofs() entries)
+        void GetGeneralizedVelocities( double* dst_gv ) const;
+
+        // Sets the generalized coordinates of the kintree (requires num_generalized_coordinates() entries)
+        void SetGeneralizedCoordinates( const double* gc );
+
+        // Sets the generalized velocities of the kintree (requires num_dofs() entries)
+        void SetGeneralizedVelocities( const double* gv );
+
+        // Sets both generalized coordinates and velocities of the kintree
+        void SetState( const double* gc, const double* gv );
+
+        // Sets the generalized forces|torques applied to the kintree on the next steps (requires num_dofs() entries)
+        void SetGeneralizedForces( const double* tau );
+
+        // Writes the world-pose of every link as [x, y, z, qw, qx, qy, qz] into dst_frames (num_links() x 7 entries), and
+        // optionally the world-frame linear|angular velocities into dst_velocities (num_links() x 6 entries, or nullptr)
+        void GetLinkFrames( double* dst_frames, double* dst_velocities = nullptr ) const;
+
+        // Returns the index of the coordinate-frame with given name (-1 if not found)
+        ssize_t GetFrameIndex( const std::string& frame_name ) const;
+
+        // Writes the joint-space mass-matrix (num_dofs() x num_dofs(), row-major) into dst_mass_matrix
+        void GetMassMatrix( double* dst_mass_matrix );
+
+        // Writes the nonlinear-effects vector (coriolis, centrifugal and gravity terms, num_dofs() entries) into dst_nonlinear_effects
+        void GetNonlinearEffects( double* dst_nonlinear_effects );
+
+        // Writes the translational jacobian (3 x num_dofs(), row-major) of the frame at given index into dst_jacobian
+        void GetFrameJacobian( ssize_t frame_index, double* dst_jacobian );
+
+        // Sets the gains of raisim's joint pd-controller (requires num_dofs() entries each), enabling pd-control
+        void SetPdGains( const double* kp, const double* kd );
+
+        // Sets the pd-targets (requires num_generalized_coordinates() and num_dofs() entries, qd_target can be nullptr)
+        void SetPdTargets( const double* q_target, const double* qd_target );
+
+        void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
+
+        bool pd_control_enabled() const { return m_PdControlEnabled; }
+
+        ssize_t num_generalized_coordinates() const { return m_NumGeneralizedCoordinates; }
+
+        ssize_t num_dofs() const { return m_NumDofs; }
+
+        ssize_t num_links() const { return m_NumLinks; }
+
+        // Whether or not the root joint of the articulated-system is a floating (free 6-dof) joint
+        bool has_floating_base() const { return m_HasFloatingBase; }
+
+        // Bytes used by this adapter, including its scratch buffers
+        size_t memory_bytes() const;
+
+        TKinematicTree* kintree() { return m_KintreeRef; }
+
+        const TKinematicTree* kintree() const { return m_KintreeRef; }
+
+        raisim::ArticulatedSystem* raisim_articulated_system() { return m_RaisimArticulatedSystemRef; }
+
+        const raisim::ArticulatedSystem* raisim_articulated_system() const { return m_RaisimArticulatedSystemRef; }
+
+    private :
+
+        // Reference to the loco kintree wrapped by this adapter
+        TKinematicTree* m_KintreeRef;
+        // Reference to the raisim-world, used to create all simulation-related objects
+        raisim::World* m_RaisimWorldRef;
+        // Path to the urdf file of the kintree
+        std::string m_ModelFilepath;
+        // Reference to the articulated-system raisim resource (owned by world)
+        raisim::ArticulatedSystem* m_RaisimArticulatedSystemRef;
+        // Dimensions of the generalized coordinates (nq) and velocities (nv)
+        ssize_t m_NumGeneralizedCoordinates;
+        ssize_t m_NumDofs;
+        // Number of links|bodies of the articulated-system
+        ssize_t m_NumLinks;
+        // Whether or not the root joint is floating
+        bool m_HasFloatingBase;
+        // Initial state of the kintree (used on reset)
+        Eigen::VectorXd m_GeneralizedCoordinates0;
+        Eigen::VectorXd m_GeneralizedVelocities0;
+        // Scratch buffers used to pass data to raisim without allocating on each call
+        Eigen::VectorXd m_ScratchGeneralizedCoordinates;
+        Eigen::VectorXd m_ScratchGeneralizedVelocities;
+        Eigen::VectorXd m_ScratchGeneralizedForces;
+        // Scratch buffer used to grab frame-jacobians from raisim without allocating on each call
+        Eigen::MatrixXd m_ScratchJacobian;
+        // Whether or not raisim's built-in pd-controller is active (enabled once gains are given)
+        bool m_PdControlEnabled;
+        // Scratch buffers used to pass pd gains|targets to raisim without allocating on each call
+        Eigen::VectorXd m_ScratchPdGainsP;
+        Eigen::VectorXd m_ScratchPdGainsD;
+        Eigen::VectorXd m_ScratchPdTargetsQ;
+        Eigen::VectorXd m_ScratchPdTargetsQd;
+    };
+
+}}
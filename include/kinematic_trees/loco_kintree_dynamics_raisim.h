@@ -0,0 +1,61 @@
+#pragma once
+
+#include <loco_parallel_raisim.h>
+#include <kinematic_trees/loco_kinematic_tree_adapter_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Spreads (in-place) a packed row-major (rows x cols) block into a padded (rows x stride) layout, zeroing the padding
+    void SpreadRowsInPlace( double* data, ssize_t rows, ssize_t cols, ssize_t stride );
+
+    // Batched query of the dynamics quantities (mass-matrices, nonlinear-effects and frame-jacobians) required
+    // by whole-body controllers. Frames are resolved once on creation, and results are written in parallel
+    // (one kintree per task) into user-given buffers. All buffers are row-major, with the dofs-dimension
+    // padded to max_num_dofs() (unused entries are zeroed):
+    //      * mass-matrices     : [num_kintrees, max_num_dofs, max_num_dofs]
+    //      * nonlinear-effects : [num_kintrees, max_num_dofs]
+    //      * frame-jacobians   : [num_kintrees, num_frames, 3, max_num_dofs]
+    class TRaisimKintreesDynamicsQuery
+    {
+    public :
+
+        TRaisimKintreesDynamicsQuery( const std::vector<TRaisimKinematicTreeAdapter*>& kintree_adapters,
+                                      const std::vector<std::string>& frame_names );
+
+        TRaisimKintreesDynamicsQuery( const TRaisimKintreesDynamicsQuery& other ) = delete;
+
+        TRaisimKintreesDynamicsQuery& operator=( const TRaisimKintreesDynamicsQuery& other ) = delete;
+
+        ~TRaisimKintreesDynamicsQuery() = default;
+
+        // Computes the requested quantities (any of the buffers can be nullptr to skip it). If no thread-pool
+        // is given, then the kintrees are processed sequentially on the calling thread
+        void Compute( double* dst_mass_matrices,
+                      double* dst_nonlinear_effects,
+                      double* dst_frame_jacobians,
+                      TRaisimThreadPool* thread_pool = nullptr );
+
+        ssize_t num_kintrees() const { return m_KintreeAdaptersRefs.size(); }
+
+        ssize_t num_frames() const { return m_NumFrames; }
+
+        ssize_t max_num_dofs() const { return m_MaxNumDofs; }
+
+    private :
+
+        void _ComputeSingle( ssize_t index, double* dst_mass_matrices, double* dst_nonlinear_effects, double* dst_frame_jacobians );
+
+    private :
+
+        // References to the kintree adapters being queried
+        std::vector<TRaisimKinematicTreeAdapter*> m_KintreeAdaptersRefs;
+        // Resolved frame-indices for each kintree ( m_FramesIndices[kintree * num_frames + frame] )
+        std::vector<ssize_t> m_FramesIndices;
+        // Number of frames queried per kintree
+        ssize_t m_NumFrames;
+        // Largest number of dofs among the queried kintrees (stride of the dofs-dimension)
+        ssize_t m_MaxNumDofs;
+    };
+
+}}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <mutex>
+
+namespace loco {
+namespace raisimlib {
+
+    // Pre-processed text of a robot model, read once from disk and shared by all articulated-systems created from it
+    struct TRaisimModelSource
+    {
+        // Absolute path to the model file this source was created from
+        std::string filepath;
+        // Folder containing the model file (used as resources path by raisim)
+        std::string resources_path;
+        // Urdf description with all mesh-references resolved to absolute paths (empty for mjcf models)
+        std::string model_str;
+        // Whether or not the model is a urdf (instantiated from model_str) or an mjcf (instantiated from filepath)
+        bool is_urdf;
+    };
+
+    // Cache of model texts keyed by model filepath. Urdf files are read and their mesh-references resolved to
+    // absolute paths only once, and articulated-systems are created from the in-memory text. This only saves the
+    // file-io and path resolution: raisim still parses the description and loads the meshes for every system it
+    // creates, and mjcf models are passed through by path.
+    class TRaisimModelSourceCache
+    {
+    public :
+
+        static TRaisimModelSourceCache& GetInstance();
+
+        TRaisimModelSourceCache( const TRaisimModelSourceCache& other ) = delete;
+
+        TRaisimModelSourceCache& operator=( const TRaisimModelSourceCache& other ) = delete;
+
+        // Returns the source of the given model file, creating it only if it's not in the cache yet
+        std::shared_ptr<const TRaisimModelSource> GetSource( const std::string& model_filepath );
+
+        // Adds an articulated-system to the given world from the (cached) source of the given model file
+        raisim::ArticulatedSystem* AddArticulatedSystem( raisim::World* raisim_world, const std::string& model_filepath );
+
+        // Removes all sources from the cache (instances already created are not affected)
+        void Clear();
+
+        ssize_t num_sources() const;
+
+    private :
+
+        TRaisimModelSourceCache() = default;
+
+        std::shared_ptr<TRaisimModelSource> _CreateSource( const std::string& model_filepath );
+
+    private :
+
+        // Guards the sources storage, as worlds might be created from several threads
+        mutable std::mutex m_Mutex;
+        // Sources storage, keyed by model filepath
+        std::unordered_map<std::string, std::shared_ptr<const TRaisimModelSource>> m_Sources;
+    };
+
+}}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace loco {
+namespace raisimlib {
+
+    // Types of backend objects whose allocations|deallocations are tracked
+    enum class eRaisimAllocType
+    {
+        SIMULATION = 0,
+        SINGLE_BODY_ADAPTER,
+        SINGLE_BODY_COLLIDER_ADAPTER,
+        COMPOUND_ADAPTER,
+        KINTREE_ADAPTER,
+        NUM_TYPES
+    };
+
+    std::string AllocTypeToString( const eRaisimAllocType& type );
+
+    // Counters of a tracked type
+    struct TRaisimAllocCounts
+    {
+        // Objects currently alive
+        int64_t live;
+        // Objects created|destroyed since the process started
+        int64_t total_created;
+        int64_t total_destroyed;
+    };
+
+    // Backtrace captured for a sampled allocation|deallocation
+    struct TRaisimAllocSample
+    {
+        eRaisimAllocType type;
+        // Whether the object was being created (true) or destroyed (false)
+        bool created;
+        // Address of the tracked object
+        const void* address;
+        // Symbolized stack-frames, from the tracking call outwards
+        std::vector<std::string> backtrace;
+    };
+
+    // Process-wide allocation tracking for the backend objects. Counting is just an atomic increment (no
+    // formatting|logging), and backtraces are only captured for every n-th event if sampling is enabled
+    class TRaisimAllocTracker
+    {
+    public :
+
+        static void OnCreated( const eRaisimAllocType& type, const void* address )
+        {
+            const int64_t count = s_Created[(ssize_t)type].fetch_add( 1, std::memory_order_relaxed ) + 1;
+            const int64_t sample_every = s_SampleEvery.load( std::memory_order_relaxed );
+            if ( sample_every > 0 && ( count % sample_every ) == 0 )
+                _RecordSample( type, true, address );
+        }
+
+        static void OnDestroyed( const eRaisimAllocType& type, const void* address )
+        {
+            const int64_t count = s_Destroyed[(ssize_t)type].fetch_add( 1, std::memory_order_relaxed ) + 1;
+            const int64_t sample_every = s_SampleEvery.load( std::memory_order_relaxed );
+            if ( sample_every > 0 && ( count % sample_every ) == 0 )
+                _RecordSample( type, false, address );
+        }
+
+        static TRaisimAllocCounts counts( const eRaisimAllocType& type );
+
+        // Captures a backtrace every sample_every events of each type (<= 0 disables sampling)
+        static void SetBacktraceSampling( int64_t sample_every );
+
+        // Returns the sampled backtraces (only the most recent ones are kept, see MAX_NUM_SAMPLES)
+        static std::vector<TRaisimAllocSample> samples();
+
+        static void ClearSamples();
+
+        // Human-readable summary of the counters of all tracked types
+        static std::string Report();
+
+    private :
+
+        static void _RecordSample( const eRaisimAllocType& type, bool created, const void* address );
+
+    private :
+
+        static constexpr ssize_t NUM_TYPES = (ssize_t)eRaisimAllocType::NUM_TYPES;
+        static constexpr ssize_t MAX_NUM_SAMPLES = 1024;
+        static constexpr ssize_t MAX_NUM_FRAMES = 32;
+
+        // Raw backtrace of a sample (symbolized only when queried)
+        struct TRawSample
+        {
+            eRaisimAllocType type;
+            bool created;
+            const void* address;
+            std::array<void*, MAX_NUM_FRAMES> frames;
+            ssize_t num_frames;
+        };
+
+        static std::array<std::atomic<int64_t>, NUM_TYPES> s_Created;
+        static std::array<std::atomic<int64_t>, NUM_TYPES> s_Destroyed;
+        static std::atomic<int64_t> s_SampleEvery;
+        // Ring of the most recent samples
+        static std::vector<TRawSample> s_Samples;
+        static ssize_t s_SamplesHead;
+        static std::mutex s_SamplesMutex;
+    };
+
+}}
+
+#if defined( LOCO_CORE_USE_TRACK_ALLOCS )
+    #define LOCO_RAISIM_TRACK_CREATED( type ) loco::raisimlib::TRaisimAllocTracker::OnCreated( loco::raisimlib::eRaisimAllocType::type, this )
+    #define LOCO_RAISIM_TRACK_DESTROYED( type ) loco::raisimlib::TRaisimAllocTracker::OnDestroyed( loco::raisimlib::eRaisimAllocType::type, this )
+#else
+    #define LOCO_RAISIM_TRACK_CREATED( type ) ((void)0)
+    #define LOCO_RAISIM_TRACK_DESTROYED( type ) ((void)0)
+#endif
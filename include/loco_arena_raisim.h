@@ -0,0 +1,70 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <cstddef>
+
+namespace loco {
+namespace raisimlib {
+
+    // Bump-allocator for the backend objects of a single world. Memory is never released per object, but all at
+    // once when the arena is destroyed, so objects placed in it must be destroyed before their arena
+    class TRaisimArena
+    {
+    public :
+
+        TRaisimArena();
+
+        TRaisimArena( const TRaisimArena& other ) = delete;
+
+        TRaisimArena& operator=( const TRaisimArena& other ) = delete;
+
+        ~TRaisimArena();
+
+        // Allocates the first block with the given number of bytes (usually the expected total for a world)
+        void Reserve( size_t num_bytes );
+
+        // Returns uninitialized memory for num_bytes with the given alignment (a new block is added if the current
+        // one runs out, so the arena never fails unless the system is out of memory)
+        void* Allocate( size_t num_bytes, size_t alignment );
+
+        // Releases all blocks at once (objects placed in the arena must have been destroyed already)
+        void Release();
+
+        // Returns an upper bound of the bytes required to place num_objects of the given type in the arena
+        template< typename T >
+        static size_t RequiredBytes( size_t num_objects ) { return num_objects * ( sizeof( T ) + alignof( T ) ); }
+
+        size_t num_blocks() const { return m_Blocks.size(); }
+
+        size_t capacity() const { return m_Capacity; }
+
+        size_t used() const { return m_Used; }
+
+    private :
+
+        void _AddBlock( size_t num_bytes );
+
+    private :
+
+        // Blocks of raw memory owned by the arena (the last one is the one being bumped)
+        std::vector<void*> m_Blocks;
+        // Current position and end of the block being bumped
+        uint8_t* m_Cursor;
+        uint8_t* m_End;
+        // Total bytes reserved by all blocks, and bytes handed out so far
+        size_t m_Capacity;
+        size_t m_Used;
+    };
+
+}}
+
+// Makes a class allocatable only from an arena (new ( arena ) TClass( ... )). Deleting such object (e.g. through
+// its owning unique_ptr) only runs its destructor, as its memory is released with the arena
+#define LOCO_RAISIM_ARENA_ALLOCATED( TClass )                                                               \
+    static void* operator new( size_t num_bytes, loco::raisimlib::TRaisimArena& arena )                     \
+    {                                                                                                       \
+        return arena.Allocate( num_bytes, alignof( TClass ) );                                              \
+    }                                                                                                       \
+    static void operator delete( void* ptr, loco::raisimlib::TRaisimArena& arena ) {}                       \
+    static void operator delete( void* ptr ) {}
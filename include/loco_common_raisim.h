@@ -50,6 +50,46 @@ namespace raisimlib {
                                      const TVec3& size, 
                                      const THeightFieldData& hfield_data );
 
+    // Creates a raisim-compound from the given primitive shapes (each with its transform w.r.t. the compound
+    // frame), whose mass-properties are shared by all shapes (computed from the shapes if not given). The raisim
+    // compound's frame sits at the com, whose position w.r.t. the compound frame is returned in dst_local_com
+    raisim::Compound* CreateCompound( raisim::World* raisim_world,
+                                      const std::vector<TShapeData>& shapes_data,
+                                      const std::vector<TMat4>& shapes_local_tfs,
+                                      const TInertialData& inertia_data,
+                                      TVec3& dst_local_com );
+
+    // Returns the inertia matrix (w.r.t. its own frame) of a primitive shape with given mass
+    raisim::Mat<3, 3> ComputePrimitiveInertia( double mass, const TShapeData& shape_data );
+
+    // Non-owning view of the elevation grid of a heightmap (row-major, rows along y, columns along x)
+    struct THeightMapGridView
+    {
+        // Reference to the (already scaled) height samples
+        const double* heights;
+        // Number of samples along the x-axis (columns)
+        ssize_t nx_samples;
+        // Number of samples along the y-axis (rows)
+        ssize_t ny_samples;
+        // Extents of the heightmap along the x-axis
+        double size_x;
+        // Extents of the heightmap along the y-axis
+        double size_y;
+        // Center of the heightmap in the xy-plane
+        double center_x;
+        double center_y;
+    };
+
+    // Returns a grid-view into the height-samples stored by the given raisim heightmap
+    THeightMapGridView GetHeightMapGridView( raisim::HeightMap* raisim_hmap );
+
+    // Computes the terrain heights (bilinear interpolation) at the xy-coordinates of the given points
+    // (points given as xyz-triplets), writing the results into dst_heights (requires num_points entries)
+    void SampleHeightsBilinear( const THeightMapGridView& grid,
+                                const double* points_xyz,
+                                ssize_t num_points,
+                                double* dst_heights );
+
     // Returns the inertia matrix of an ellipsoid with given mass and half-extents
     raisim::Mat<3, 3> ComputeEllipsoidInertia( double mass, const TVec3& half_extents );
 
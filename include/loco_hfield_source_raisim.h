@@ -0,0 +1,40 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Encoding of the samples stored in a binary heightfield file
+    enum class eRaisimHfieldSampleType
+    {
+        FLOAT32 = 0,
+        INT16
+    };
+
+    // Binary file used as the source of a heightfield's samples instead of the heights in its loco collider data,
+    // so large terrains never have to be held in memory as float|double vectors. Samples are stored row-major
+    // (ny_samples rows of nx_samples each) after an optional header, and decoded as size.z * (raw * scale + offset)
+    struct TRaisimHfieldFileSource
+    {
+        std::string filepath;
+        eRaisimHfieldSampleType sample_type = eRaisimHfieldSampleType::FLOAT32;
+        ssize_t nx_samples = 0;
+        ssize_t ny_samples = 0;
+        // Bytes to skip at the start of the file (e.g. a header written by the terrain tool)
+        size_t header_bytes = 0;
+        double scale = 1.0;
+        double offset = 0.0;
+    };
+
+    // Returns the number of bytes of a single sample of the given type
+    size_t HfieldSampleBytes( const eRaisimHfieldSampleType& sample_type );
+
+    // Creates a raisim heightmap whose samples are read (through mmap) from the given binary file. The samples
+    // are decoded into a single transient buffer (freed on return), which raisim copies into its own resident
+    // storage, so no other copy of the file's data is made
+    raisim::HeightMap* CreateHfieldFromFile( raisim::World* raisim_world,
+                                             const TVec3& size,
+                                             const TRaisimHfieldFileSource& source );
+
+}}
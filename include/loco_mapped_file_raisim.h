@@ -0,0 +1,49 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Read-only memory-mapping of a whole file. Pages are loaded lazily by the OS (and shared among processes
+    // mapping the same file), so opening even a large file is cheap and nothing is copied up-front
+    class TRaisimMappedFile
+    {
+    public :
+
+        TRaisimMappedFile();
+
+        TRaisimMappedFile( const TRaisimMappedFile& other ) = delete;
+
+        TRaisimMappedFile& operator=( const TRaisimMappedFile& other ) = delete;
+
+        ~TRaisimMappedFile();
+
+        // Maps the file at the given path, returning false if it couldn't be opened|mapped
+        bool Open( const std::string& filepath );
+
+        // Unmaps the file (pointers returned by data() are invalid afterwards)
+        void Close();
+
+        // Hints the OS that the given range will be read soon (or sequentially), so it can prefetch it
+        void Prefetch( size_t offset, size_t num_bytes ) const;
+
+        bool is_open() const { return m_Data != nullptr; }
+
+        const uint8_t* data() const { return m_Data; }
+
+        size_t size() const { return m_Size; }
+
+        const std::string& filepath() const { return m_Filepath; }
+
+    private :
+
+        // Start of the mapping (nullptr if not mapped)
+        const uint8_t* m_Data;
+        // Size of the mapped file (in bytes)
+        size_t m_Size;
+        // Path of the mapped file
+        std::string m_Filepath;
+    };
+
+}}
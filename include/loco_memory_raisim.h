@@ -0,0 +1,73 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <map>
+
+namespace loco {
+namespace raisimlib {
+
+    // Memory used by a single asset (raisim object plus the buffers it owns)
+    struct TRaisimAssetMemory
+    {
+        // Name of the loco object wrapping the asset (or "raisim_obj_<index>" if not created through loco)
+        std::string name;
+        // Raisim object-type of the asset (sphere, box, mesh, heightmap, ...)
+        std::string type;
+        // Total bytes attributed to this asset
+        size_t bytes;
+    };
+
+    // Memory used by one or more raisim worlds. Object and buffer sizes are exact for the parts exposed by
+    // raisim (object structs, height samples, contact lists). Fields prefixed with estimated_ are heuristics
+    // for buffers raisim doesn't expose (mesh data from the user vertex-data or the file size on disk, and the
+    // dense joint-space dynamics of articulated systems)
+    struct TRaisimMemoryReport
+    {
+        // Number of worlds aggregated in this report
+        ssize_t num_worlds = 0;
+        // Number of objects and bytes used by the raisim objects themselves, per object-type
+        std::map<std::string, ssize_t> num_objects_per_type;
+        std::map<std::string, size_t> object_bytes_per_type;
+        // Height samples kept by raisim heightmaps
+        size_t hfield_bytes = 0;
+        // Height samples kept by the loco scenario (single-precision copy the raisim heightmaps are built from)
+        size_t core_hfield_bytes = 0;
+        // Transient scaled copy of the height samples made by CreateHfield while building (peak, not resident)
+        size_t hfield_build_copy_bytes = 0;
+        // Vertex|index data of meshes (estimated)
+        size_t estimated_mesh_bytes = 0;
+        // Contact lists of all objects (capacity, as raisim reuses them across steps)
+        size_t contact_bytes = 0;
+        // Dense joint-space dynamics of articulated systems, i.e. mass-matrix, its factorization and nonlinear-effects (estimated)
+        size_t estimated_dynamics_bytes = 0;
+        // Adapters and their scratch buffers (backend-side bookkeeping)
+        size_t adapter_bytes = 0;
+        // Largest assets (sorted by bytes, at most MAX_NUM_ASSETS entries)
+        std::vector<TRaisimAssetMemory> assets;
+
+        static constexpr ssize_t MAX_NUM_ASSETS = 32;
+
+        size_t object_bytes() const;
+
+        // Resident bytes (excludes the transient heightfield build-copy)
+        size_t total_bytes() const;
+
+        // Sorts the assets by bytes (largest first), keeping at most MAX_NUM_ASSETS of them
+        void SortAssets();
+
+        // Adds the usage of another report (e.g. to aggregate the worlds of a vectorized set)
+        TRaisimMemoryReport& operator+=( const TRaisimMemoryReport& other );
+
+        std::string ToString() const;
+    };
+
+    std::string ObjectTypeToString( const raisim::ObjectType& type );
+
+    // Bytes used by the raisim object struct of the given type (buffers it owns are not included)
+    size_t ObjectStructBytes( const raisim::Object* raisim_object );
+
+    // Aggregates the reports of several worlds into a single one
+    TRaisimMemoryReport AggregateMemoryReports( const std::vector<TRaisimMemoryReport>& reports );
+
+}}
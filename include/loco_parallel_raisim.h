@@ -0,0 +1,62 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace loco {
+namespace raisimlib {
+
+    // Minimal fork-join thread-pool with persistent workers. The calling thread takes part in each
+    // parallel-for, and calls are expected to be made from a single thread at a time
+    class TRaisimThreadPool
+    {
+    public :
+
+        // Creates a pool that runs tasks on num_threads threads (caller included). If num_threads <= 0,
+        // then the number of hardware threads is used
+        TRaisimThreadPool( ssize_t num_threads );
+
+        TRaisimThreadPool( const TRaisimThreadPool& other ) = delete;
+
+        TRaisimThreadPool& operator=( const TRaisimThreadPool& other ) = delete;
+
+        ~TRaisimThreadPool();
+
+        // Runs task(i) for all i in [0, num_tasks), returning once all tasks are done
+        void ParallelFor( ssize_t num_tasks, const std::function<void( ssize_t )>& task );
+
+        ssize_t num_threads() const { return m_Workers.size() + 1; }
+
+    private :
+
+        void _WorkerLoop();
+
+        void _RunTasks();
+
+    private :
+
+        // Worker threads (the caller of ParallelFor is the remaining thread)
+        std::vector<std::thread> m_Workers;
+        // Synchronization for dispatching|joining the work of each parallel-for
+        std::mutex m_Mutex;
+        std::condition_variable m_CvWorkAvailable;
+        std::condition_variable m_CvWorkDone;
+        // Task being currently run, and its total number of entries
+        const std::function<void( ssize_t )>* m_TaskRef;
+        ssize_t m_NumTasks;
+        // Next task-entry to be grabbed by any thread
+        std::atomic<ssize_t> m_NextTask;
+        // Number of workers still running entries of the current parallel-for
+        ssize_t m_NumWorkersActive;
+        // Id of the current parallel-for (used by workers to detect new work)
+        uint64_t m_Generation;
+        // Whether or not workers should exit
+        bool m_Stop;
+    };
+
+}}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <array>
+#include <chrono>
+
+namespace loco {
+namespace raisimlib {
+
+    // Summary of the samples collected by a timing-accumulator (times given in nanoseconds)
+    struct TRaisimTimingStats
+    {
+        // Number of samples collected
+        ssize_t count;
+        // Mean of all samples
+        double mean;
+        // Median and 99th-percentile (approximated by the histogram, with ~3% relative error)
+        double p50;
+        double p99;
+        // Largest sample collected
+        double max;
+    };
+
+    // Timings of each phase of a simulation step (the backend has no pre-step work of its own, so there's no
+    // pre-step phase). Work the base simulation does before the pre-step hook or after the post-step hook
+    // isn't visible to the backend, so it's not accounted for
+    struct TRaisimStepStats
+    {
+        // Integration loop (all raisim substeps of a single step)
+        TRaisimTimingStats sim_step;
+        // Backend post-step (contact-sensors, recorder)
+        TRaisimTimingStats post_step;
+        // Scenario sync: time spent by the base simulation between the backend phases, plus writing the raisim
+        // state back into the loco compounds|kintrees after the post-step
+        TRaisimTimingStats sync;
+    };
+
+    // Accumulates timing samples into a fixed-size log-scale histogram, so adding a sample is O(1)
+    // and never allocates, while percentiles are still available on request
+    class TRaisimTimingAccumulator
+    {
+    public :
+
+        TRaisimTimingAccumulator();
+
+        void AddSample( int64_t elapsed_ns );
+
+        void Reset();
+
+        TRaisimTimingStats stats() const;
+
+    private :
+
+        static ssize_t _BucketIndex( int64_t elapsed_ns );
+
+        static double _BucketValue( ssize_t bucket_index );
+
+        double _Percentile( double quantile ) const;
+
+    private :
+
+        // Each power-of-two range is split into this many linear sub-buckets
+        static constexpr ssize_t NUM_SUB_BUCKETS_BITS = 4;
+        static constexpr ssize_t NUM_SUB_BUCKETS = 1 << NUM_SUB_BUCKETS_BITS;
+        static constexpr ssize_t NUM_BUCKETS = 64 * NUM_SUB_BUCKETS;
+
+        // Histogram of the samples collected so far
+        std::array<uint32_t, NUM_BUCKETS> m_Histogram;
+        // Running values used for the exact mean and max
+        int64_t m_Count;
+        int64_t m_TotalNs;
+        int64_t m_MaxNs;
+    };
+
+    // Adds the time elapsed during its lifetime to the given accumulator
+    class TRaisimScopedTimer
+    {
+    public :
+
+        TRaisimScopedTimer( TRaisimTimingAccumulator& accumulator )
+            : m_AccumulatorRef( &accumulator ), m_Start( std::chrono::steady_clock::now() ) {}
+
+        TRaisimScopedTimer( const TRaisimScopedTimer& other ) = delete;
+
+        TRaisimScopedTimer& operator=( const TRaisimScopedTimer& other ) = delete;
+
+        ~TRaisimScopedTimer()
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_Start;
+            m_AccumulatorRef->AddSample( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() );
+        }
+
+    private :
+
+        TRaisimTimingAccumulator* m_AccumulatorRef;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+}}
+
+#if defined( LOCO_RAISIM_USE_PROFILING )
+    #define LOCO_RAISIM_PROFILE_SCOPE( accumulator ) loco::raisimlib::TRaisimScopedTimer _loco_raisim_scoped_timer( accumulator )
+#else
+    #define LOCO_RAISIM_PROFILE_SCOPE( accumulator ) ((void)0)
+#endif
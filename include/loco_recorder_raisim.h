@@ -0,0 +1,142 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_recording_codec_raisim.h>
+
+#include <atomic>
+#include <thread>
+
+namespace loco {
+namespace raisimlib {
+
+    class TRaisimContactSensors;
+
+    // Identifier at the start of every recording
+    constexpr char RAISIM_RECORDING_MAGIC[8] = { 'L', 'O', 'C', 'O', 'R', 'R', 'E', 'C' };
+
+    // Version of the recording format (bumped on any layout change)
+    constexpr uint32_t RAISIM_RECORDING_VERSION = 3;
+
+    // Number of values recorded per single-body: position (3), quaternion wxyz (4), linear (3) and angular (3) velocity
+    constexpr ssize_t RAISIM_RECORDING_BODY_DIM = 13;
+
+    // Header at the start of a recording. It's followed by the names of the recorded bodies and kintrees (each one
+    // terminated by a newline), the number of generalized coordinates and dofs of each kintree (uint64 pairs), and
+    // then by num_frames frames, each one laid out (when raw, frame_bytes each) as
+    // [time, bodies (num_bodies x 13), kintrees (gc|gv of each, num_kintree_values in total), contact-readings].
+    // If quantized, the frames take frames_bytes in total, and are followed by the offsets of each keyframe
+    // (num_keyframes uint64 values, relative to frames_offset)
+    struct TRaisimRecordingHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t num_bodies;
+        uint32_t num_kintrees;
+        uint32_t num_contact_sensors;
+        uint64_t num_kintree_values;
+        uint64_t frame_bytes;
+        uint64_t names_offset;
+        uint64_t names_bytes;
+        uint64_t kintree_dims_offset;
+        uint64_t frames_offset;
+        uint64_t num_frames;
+        double time_step;
+        TRaisimRecordingCompression compression;
+        uint64_t frames_bytes;
+        uint64_t keyframes_offset;
+        uint64_t num_keyframes;
+    };
+
+    // Streams the state of a world after every step into a chunked, memory-mapped binary file. The sim thread only
+    // copies the state into a ring buffer (frames are dropped and counted if it's full, never waited for), and a
+    // background thread moves frames from there into the mapped chunks of the file
+    class TRaisimTrajectoryRecorder
+    {
+    public :
+
+        // Records the given (named) raisim single-bodies and articulated-systems, and the readings of the
+        // contact-sensors if given (all objects are owned by the simulation, and must outlive the recorder)
+        TRaisimTrajectoryRecorder( const std::vector<std::pair<std::string, raisim::SingleBodyObject*>>& bodies,
+                                   const std::vector<std::pair<std::string, raisim::ArticulatedSystem*>>& kintrees,
+                                   const TRaisimContactSensors* contact_sensors_ref,
+                                   double time_step );
+
+        TRaisimTrajectoryRecorder( const TRaisimTrajectoryRecorder& other ) = delete;
+
+        TRaisimTrajectoryRecorder& operator=( const TRaisimTrajectoryRecorder& other ) = delete;
+
+        ~TRaisimTrajectoryRecorder();
+
+        // Creates the recording file and starts the writer thread (ring_frames frames are buffered in memory,
+        // and the file grows by chunk_bytes at a time). Frames are compressed (if requested) by the writer thread
+        bool Start( const std::string& filepath, ssize_t ring_frames, size_t chunk_bytes,
+                    const TRaisimRecordingCompression& compression = TRaisimRecordingCompression() );
+
+        // Copies the current state into the ring buffer (called from the sim thread after each step)
+        void Record( double time );
+
+        // Flushes all buffered frames, finalizes the header and closes the file
+        bool Stop();
+
+        bool is_recording() const { return m_Running.load( std::memory_order_relaxed ); }
+
+        size_t frame_bytes() const { return m_FrameBytes; }
+
+        // Frames written to the file, and frames dropped because the ring buffer was full
+        int64_t num_frames_written() const { return m_Tail.load( std::memory_order_acquire ); }
+
+        int64_t num_frames_dropped() const { return m_NumDropped.load( std::memory_order_relaxed ); }
+
+        // Bytes taken by the frames written to the file so far (written by the writer thread)
+        uint64_t frames_bytes() const { return m_FramesBytes.load( std::memory_order_relaxed ); }
+
+    private :
+
+        void _WriterLoop();
+
+        // Writes the frame into the file (quantized and delta-coded, if compressing)
+        bool _WriteFrame( const uint8_t* frame, int64_t frame_index );
+
+        // Copies num_bytes into the file at the current write offset, mapping new chunks as required
+        bool _WriteBytes( const uint8_t* data, size_t num_bytes );
+
+        void _UnmapChunk();
+
+    private :
+
+        // References to the recorded raisim objects (owned by the world)
+        std::vector<raisim::SingleBodyObject*> m_RaisimBodiesRefs;
+        std::vector<raisim::ArticulatedSystem*> m_RaisimKintreesRefs;
+        // Reference to the recorded contact-sensors (owned by the simulation, nullptr if not recording contacts)
+        const TRaisimContactSensors* m_ContactSensorsRef;
+        // Layout of the recording
+        TRaisimRecordingHeader m_Header;
+        std::string m_Names;
+        std::vector<uint64_t> m_KintreeDims;
+        // Codec used to compress the frames (only if compressing), with scratch buffers for the writer thread
+        std::unique_ptr<TRaisimRecordingCodec> m_Codec;
+        std::vector<int64_t> m_Values;
+        std::vector<int64_t> m_PrevValues;
+        std::vector<uint8_t> m_EncodedBytes;
+        // Offsets of the keyframes written so far (relative to the start of the frames)
+        std::vector<uint64_t> m_KeyframeOffsets;
+        std::atomic<uint64_t> m_FramesBytes;
+        size_t m_FrameBytes;
+        // Ring buffer of frames, with the number of frames produced (head) and written to the file (tail)
+        std::vector<uint8_t> m_Ring;
+        ssize_t m_RingFrames;
+        std::atomic<int64_t> m_Head;
+        std::atomic<int64_t> m_Tail;
+        std::atomic<int64_t> m_NumDropped;
+        // Writer thread, and whether or not it should keep running
+        std::thread m_Writer;
+        std::atomic<bool> m_Running;
+        // Recording file, and the chunk of it that's currently mapped
+        int m_FileDescriptor;
+        size_t m_ChunkBytes;
+        uint8_t* m_ChunkData;
+        uint64_t m_ChunkOffset;
+        uint64_t m_WriteOffset;
+    };
+
+}}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    struct TRaisimRecordingHeader;
+
+    // How the frames of a recording are stored
+    enum class eRaisimRecordingCodec : uint32_t
+    {
+        // Frames stored as-is (frame_bytes each), so they can be read in place
+        RAW = 0,
+        // Frames quantized and delta-coded in blocks starting at a keyframe (variable size)
+        QUANTIZED
+    };
+
+    // Settings of the quantized codec (resolutions are the largest error allowed for each kind of value)
+    struct TRaisimRecordingCompression
+    {
+        eRaisimRecordingCodec codec = eRaisimRecordingCodec::RAW;
+        // Resolution of positions and kintree generalized-coordinates
+        double position_resolution = 1e-4;
+        // Resolution of linear|angular velocities and kintree generalized-velocities
+        double velocity_resolution = 1e-3;
+        // Resolution of contact forces|torques
+        double force_resolution = 1e-2;
+        // Bits used for each of the three smallest components of a quaternion
+        uint32_t quaternion_bits = 15;
+        // Number of frames in each block (a keyframe followed by keyframe_interval - 1 delta-frames)
+        uint32_t keyframe_interval = 64;
+    };
+
+    // Resolution used for the time of each frame (in seconds)
+    constexpr double RAISIM_RECORDING_TIME_RESOLUTION = 1e-6;
+
+    // Quantizes, delta-codes and packs the frames of a recording (and does the reverse). Every value of a raw frame
+    // becomes an integer: times, positions, velocities and forces are rounded to their resolution, quaternions are
+    // smallest-three encoded (index of the dropped component plus the other three), and contact counts are kept.
+    // A keyframe stores these integers as zigzag-varints, and every other frame stores a bitmask of the values that
+    // changed since the previous frame followed by the varint-coded differences, so values at rest cost one bit.
+    // Decoding any frame only requires the frames of its block, so seeking stays a jump to the closest keyframe
+    class TRaisimRecordingCodec
+    {
+    public :
+
+        // Sets up the layout of the frames from the header of the recording (counts and compression settings) and
+        // the number of generalized coordinates and dofs of each kintree (num_kintrees pairs)
+        TRaisimRecordingCodec( const TRaisimRecordingHeader& header, const uint64_t* kintree_dims );
+
+        TRaisimRecordingCodec( const TRaisimRecordingCodec& other ) = delete;
+
+        TRaisimRecordingCodec& operator=( const TRaisimRecordingCodec& other ) = delete;
+
+        ~TRaisimRecordingCodec() = default;
+
+        // Converts a raw frame into its integer values (num_values() entries)
+        void Quantize( const double* frame, int64_t* dst_values ) const;
+
+        // Converts the integer values of a frame back into a raw frame
+        void Dequantize( const int64_t* values, double* dst_frame ) const;
+
+        // Appends the given values to dst_bytes, as a keyframe if prev_values is nullptr, or as the difference from
+        // prev_values (the values of the previous frame) otherwise
+        void Encode( const int64_t* values, const int64_t* prev_values, std::vector<uint8_t>& dst_bytes ) const;
+
+        // Reads the frame starting at src_bytes into dst_values (prev_values as in Encode), returning a pointer to
+        // the next frame, or nullptr if the frame goes past src_bytes_end
+        const uint8_t* Decode( const uint8_t* src_bytes, const uint8_t* src_bytes_end,
+                               const int64_t* prev_values, int64_t* dst_values ) const;
+
+        ssize_t num_values() const { return m_Channels.size(); }
+
+    private :
+
+        // Kind of each value of a raw frame (quaternions take four consecutive values)
+        enum class eChannel : uint8_t
+        {
+            TIME = 0, POSITION, QUATERNION, VELOCITY, FORCE, COUNT
+        };
+
+        // Kind of each value of a raw frame
+        std::vector<eChannel> m_Channels;
+        // Resolution of each kind of value
+        double m_Resolutions[6];
+        // Largest integer a quaternion component is quantized to
+        int64_t m_QuaternionMax;
+    };
+
+}}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_mapped_file_raisim.h>
+#include <loco_recorder_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Plays back a recording (see TRaisimTrajectoryRecorder) by writing the recorded state of each frame straight
+    // into the raisim objects of a world, without integrating. The recording is memory-mapped, so raw frames are
+    // read in place and any of them can be jumped to at no extra cost. Quantized frames are decoded from the
+    // keyframe of their block (or from the last decoded frame, when going forward within a block)
+    class TRaisimTrajectoryReplayer
+    {
+    public :
+
+        TRaisimTrajectoryReplayer();
+
+        TRaisimTrajectoryReplayer( const TRaisimTrajectoryReplayer& other ) = delete;
+
+        TRaisimTrajectoryReplayer& operator=( const TRaisimTrajectoryReplayer& other ) = delete;
+
+        ~TRaisimTrajectoryReplayer() = default;
+
+        // Maps the recording at the given path, returning false if it's missing, outdated or truncated
+        bool Open( const std::string& filepath );
+
+        // Links the recorded body with given name to the raisim object its state is written to (false if the
+        // recording has no such body)
+        bool BindBody( const std::string& name, raisim::SingleBodyObject* raisim_body_ref );
+
+        // Links the recorded kintree with given name to the raisim object its state is written to (false if the
+        // recording has no such kintree, or if its number of coordinates|dofs changed since recording)
+        bool BindKintree( const std::string& name, raisim::ArticulatedSystem* raisim_kintree_ref );
+
+        // Writes the state of the given frame into all bound raisim objects (unbound ones are skipped)
+        void ApplyFrame( ssize_t frame_index );
+
+        // Time at which the given frame was recorded
+        double frame_time( ssize_t frame_index ) const { return *_frame( frame_index ); }
+
+        // Raw values of the given frame (time first, same layout as written by the recorder). When decoding, the
+        // returned buffer is only valid until another frame is requested
+        const double* frame( ssize_t frame_index ) const { return _frame( frame_index ); }
+
+        // Index of the last frame recorded at or before the given time (0 if before the first frame)
+        ssize_t FindFrame( double time ) const;
+
+        ssize_t num_frames() const { return m_Header ? m_Header->num_frames : 0; }
+
+        ssize_t num_bodies() const { return m_BodyNames.size(); }
+
+        ssize_t num_kintrees() const { return m_KintreeNames.size(); }
+
+        double time_step() const { return m_Header ? m_Header->time_step : 0.0; }
+
+        eRaisimRecordingCodec codec() const { return m_Header ? m_Header->compression.codec : eRaisimRecordingCodec::RAW; }
+
+        const std::vector<std::string>& body_names() const { return m_BodyNames; }
+
+        const std::vector<std::string>& kintree_names() const { return m_KintreeNames; }
+
+    private :
+
+        // Returns the raw values of the given frame (read in place, or decoded into the scratch frame)
+        const double* _frame( ssize_t frame_index ) const;
+
+    private :
+
+        // Mapping of the whole recording
+        TRaisimMappedFile m_File;
+        // Header of the recording (points into the mapping, nullptr if not opened)
+        const TRaisimRecordingHeader* m_Header;
+        // Names of the recorded bodies and kintrees (in recording order)
+        std::vector<std::string> m_BodyNames;
+        std::vector<std::string> m_KintreeNames;
+        // Raisim objects each recorded body|kintree is written to (owned by the world, nullptr if unbound)
+        std::vector<raisim::SingleBodyObject*> m_RaisimBodiesRefs;
+        std::vector<raisim::ArticulatedSystem*> m_RaisimKintreesRefs;
+        // Offset (in values, after the frame's time) of the gc|gv of each kintree, and their sizes
+        std::vector<ssize_t> m_KintreeOffsets;
+        std::vector<ssize_t> m_KintreeNumGc;
+        std::vector<ssize_t> m_KintreeNumGv;
+        // Codec used to decode the frames (only if quantized), and offsets of each keyframe (points into the mapping)
+        std::unique_ptr<TRaisimRecordingCodec> m_Codec;
+        const uint64_t* m_KeyframeOffsets;
+        // Last decoded frame, its integer values, and where the frame after it starts in the mapping
+        mutable ssize_t m_DecodedFrameIndex;
+        mutable std::vector<double> m_DecodedFrame;
+        mutable std::vector<int64_t> m_DecodedValues;
+        mutable std::vector<int64_t> m_ScratchValues;
+        mutable const uint8_t* m_DecodeCursor;
+        // Scratch buffers used to pass the state of each kintree to raisim without allocating on each frame
+        std::vector<Eigen::VectorXd> m_ScratchGc;
+        std::vector<Eigen::VectorXd> m_ScratchGv;
+    };
+
+}}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_mapped_file_raisim.h>
+
+#include <unordered_map>
+
+namespace loco {
+    class TSingleBody;
+}
+
+namespace loco {
+namespace raisimlib {
+
+    // Version of the precompiled-scene format (bumped on any layout change, older files are then rejected)
+    constexpr uint32_t RAISIM_SCENE_FILE_VERSION = 2;
+
+    // Header at the start of a precompiled-scene file (all offsets are in bytes, from the start of the file)
+    struct TRaisimSceneFileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t num_bodies;
+        uint64_t records_offset;
+        uint64_t payload_offset;
+        uint64_t file_size;
+    };
+
+    // Fully resolved single-body, as stored in a precompiled-scene file (plain-old-data, read in-place)
+    struct TRaisimSceneBodyRecord
+    {
+        // Name of the body (in the payload, not null-terminated)
+        uint64_t name_offset;
+        uint64_t name_length;
+        // Shape (loco eShapeType) and dynamics-type (loco eDynamicsType)
+        int32_t shape_type;
+        int32_t dyntype;
+        // Hash of the collider and inertial data the record was resolved from (see ComputeSceneBodyHash)
+        uint64_t source_hash;
+        // Shape size, and resolved mass-properties (inertia as row-major 3x3, w.r.t. the body frame)
+        double size[3];
+        double mass;
+        double inertia[9];
+        // Initial state (rotation as row-major 3x3)
+        double position[3];
+        double rotation[9];
+        double linear_vel[3];
+        double angular_vel[3];
+        // Heightmap samples, extents and center (hfields only), with the final heights in the payload
+        uint64_t hfield_num_x;
+        uint64_t hfield_num_y;
+        double hfield_size_x;
+        double hfield_size_y;
+        double hfield_center_x;
+        double hfield_center_y;
+        uint64_t heights_offset;
+    };
+
+    // Fingerprint (64-bit FNV-1a) of the collider data and inertial data of a single-body, used to detect records
+    // that are out of date w.r.t. the scenario. Shape, size and inertial data are hashed in full, while mesh and
+    // heightfield buffers only contribute their sizes and a bounded number of sampled values, so checking a record
+    // costs the same for any geometry (edits to unsampled vertices|heights aren't detected: recompile the scene)
+    uint64_t ComputeSceneBodyHash( const TShapeData& shape_data, const TInertialData& inertia_data );
+
+    // Precompiled scene: resolved mass-properties, geometry, heightmaps and initial states of all single-bodies
+    // of a prepared raisim world, loaded through mmap so that rebuilding the world skips all preprocessing
+    // (volume|inertia computations, mesh AABBs, heightfield rescaling)
+    class TRaisimSceneFile
+    {
+    public :
+
+        TRaisimSceneFile();
+
+        TRaisimSceneFile( const TRaisimSceneFile& other ) = delete;
+
+        TRaisimSceneFile& operator=( const TRaisimSceneFile& other ) = delete;
+
+        ~TRaisimSceneFile();
+
+        // Writes the given single-bodies, with their already built raisim objects, into a precompiled-scene file
+        static bool Save( const std::string& filepath,
+                          const std::vector<TSingleBody*>& bodies,
+                          const std::vector<raisim::SingleBodyObject*>& raisim_bodies );
+
+        // Maps and validates a precompiled-scene file (header and every record, so no reads go past the mapping),
+        // returning false if it's missing, corrupted or outdated
+        bool Open( const std::string& filepath );
+
+        // Returns the record of the body with given name (nullptr if the scene has no such body)
+        const TRaisimSceneBodyRecord* FindBody( const std::string& body_name ) const;
+
+        // Creates the raisim object of a body from its record, without any preprocessing. The shape and inertial
+        // data from the scenario are only used to check the record is up to date (and for the geometry of meshes),
+        // so nullptr is returned if they don't match (callers should then build the body the usual way)
+        raisim::SingleBodyObject* CreateBody( raisim::World* raisim_world,
+                                              const TRaisimSceneBodyRecord& record,
+                                              const TShapeData& shape_data,
+                                              const TInertialData& inertia_data ) const;
+
+        bool is_open() const { return m_File.is_open(); }
+
+        ssize_t num_bodies() const { return m_NumBodies; }
+
+        const TRaisimSceneBodyRecord& record( ssize_t index ) const { return m_RecordsRef[index]; }
+
+        const std::string& filepath() const { return m_File.filepath(); }
+
+    private :
+
+        // Mapping of the whole file
+        TRaisimMappedFile m_File;
+        // Number of body records, and reference to the records (in the mapping)
+        ssize_t m_NumBodies;
+        const TRaisimSceneBodyRecord* m_RecordsRef;
+        // Reference to the payload (names and heights, in the mapping)
+        const uint8_t* m_PayloadRef;
+        // Lookup-table for the records (keyed by body name)
+        std::unordered_map<std::string, ssize_t> m_RecordsMap;
+    };
+
+}}
@@ -1,10 +1,25 @@
 #pragma onnce
 
 #include <loco_common_raisim.h>
+#include <loco_arena_raisim.h>
+#include <loco_parallel_raisim.h>
+#include <loco_profiling_raisim.h>
+#include <loco_memory_raisim.h>
+#include <loco_scene_file_raisim.h>
+#include <loco_recorder_raisim.h>
+#include <loco_replayer_raisim.h>
 #include <loco_simulation.h>
 
 #include <primitives/loco_single_body_collider_adapter_raisim.h>
 #include <primitives/loco_single_body_adapter_raisim.h>
+#include <primitives/loco_single_body_batch_raisim.h>
+#include <primitives/loco_body_pool_raisim.h>
+#include <primitives/loco_static_merger_raisim.h>
+#include <compounds/loco_compound_adapter_raisim.h>
+#include <kinematic_trees/loco_kinematic_tree_adapter_raisim.h>
+#include <kinematic_trees/loco_joint_controller_raisim.h>
+#include <kinematic_trees/loco_kintree_dynamics_raisim.h>
+#include <sensors/loco_contact_sensors_raisim.h>
 
 namespace loco {
 namespace raisimlib {
@@ -13,7 +28,11 @@ namespace raisimlib {
     {
     public :
 
-        TRaisimSimulation( TScenario* scenarioRef );
+        // If batch_single_bodies is set, all single-bodies are built, initialized and reset by a single batch-object
+        // (their adapters are kept only for per-body queries|setters from the user side). If merge_static_bodies is
+        // set, static single-bodies with primitive shapes are merged into a few static compounds instead (these get
+        // no adapters, so use GetMergedStaticCompound to query them)
+        TRaisimSimulation( TScenario* scenarioRef, bool batch_single_bodies = false, bool merge_static_bodies = false );
 
         TRaisimSimulation( const TRaisimSimulation& other ) = delete;
 
@@ -25,6 +44,145 @@ namespace raisimlib {
 
         const raisim::World* raisim_world() const { return m_RaisimWorld.get(); }
 
+        // Attaches a contact-sensor to the single-body with given name, returning its reading slot (-1 if not found)
+        ssize_t AddContactSensor( const std::string& body_name );
+
+        TRaisimContactSensors& contact_sensors() { return m_ContactSensors; }
+
+        const TRaisimContactSensors& contact_sensors() const { return m_ContactSensors; }
+
+        bool batch_single_bodies() const { return m_BatchSingleBodies; }
+
+        bool merge_static_bodies() const { return m_MergeStaticBodies; }
+
+        // Returns the static compound the single-body with given name was merged into, and optionally the index of
+        // its shape in there (nullptr if the body wasn't merged)
+        raisim::Compound* GetMergedStaticCompound( const std::string& body_name, ssize_t* dst_child_index = nullptr );
+
+        TRaisimStaticMerger& static_merger() { return m_StaticMerger; }
+
+        const TRaisimStaticMerger& static_merger() const { return m_StaticMerger; }
+
+        TRaisimSingleBodyBatch& single_body_batch() { return m_SingleBodyBatch; }
+
+        const TRaisimSingleBodyBatch& single_body_batch() const { return m_SingleBodyBatch; }
+
+        // Adapters of all single-bodies (in scenario order)
+        std::vector<TRaisimSingleBodyAdapter*> single_body_adapters();
+
+        // Pre-creates num_bodies parked objects with the given shape, which can then be spawned at any time (even
+        // after initialization) without rebuilding the world
+        bool ReservePooledBodies( const TShapeData& shape_data, const TInertialData& inertia_data, ssize_t num_bodies );
+
+        // Spawns a pooled object with the given shape and mass, returning its handle (-1 if none is available)
+        ssize_t SpawnBody( const TShapeData& shape_data,
+                           const TInertialData& inertia_data,
+                           const TMat4& transform,
+                           const TVec3& linear_vel = TVec3(),
+                           const TVec3& angular_vel = TVec3() );
+
+        // Parks back the spawned object with given handle (all spawned objects are also parked on reset)
+        bool DespawnBody( ssize_t handle );
+
+        TRaisimBodyPool& body_pool() { return m_BodyPool; }
+
+        const TRaisimBodyPool& body_pool() const { return m_BodyPool; }
+
+        // Writes the single-bodies of this (initialized) simulation into a precompiled-scene file
+        bool SavePrecompiledScene( const std::string& filepath );
+
+        // Builds single-bodies from a precompiled-scene file instead of preprocessing them (must be called before
+        // initializing). Bodies missing from the file, or whose shape changed since it was saved, are built as usual
+        bool LoadPrecompiledScene( const std::string& filepath );
+
+        // Reads the heights of the heightfield single-body with given name from a binary file (must be called before
+        // initializing), instead of from the heights in its collider data
+        bool SetHfieldFileSource( const std::string& body_name, const TRaisimHfieldFileSource& source );
+
+        // Starts streaming the state of all dynamic single-bodies and kintrees (and the contact-sensor readings, if
+        // requested) after each step into a recording file (must be called after initializing). Only a copy into a
+        // ring of ring_frames frames happens on the stepping thread, the file itself (compressed if requested) is
+        // written in the background
+        bool StartRecording( const std::string& filepath,
+                             bool record_contacts = false,
+                             const TRaisimRecordingCompression& compression = TRaisimRecordingCompression(),
+                             ssize_t ring_frames = 1024,
+                             size_t chunk_bytes = 64 * 1024 * 1024 );
+
+        // Flushes and closes the current recording
+        bool StopRecording();
+
+        // Recorder of the current (or last) recording (nullptr if never recorded)
+        TRaisimTrajectoryRecorder* recorder() { return m_Recorder.get(); }
+
+        const TRaisimTrajectoryRecorder* recorder() const { return m_Recorder.get(); }
+
+        // Switches to replaying a recording (must be called after initializing): from here on, each step writes the
+        // next recorded frame into the bodies and kintrees with matching names instead of integrating the world
+        bool StartReplay( const std::string& filepath );
+
+        // Jumps to the given frame of the replay, applying it right away (false if not replaying or out of range)
+        bool SeekReplay( ssize_t frame_index );
+
+        // Switches back to simulating the world (from the state of the last replayed frame)
+        void StopReplay();
+
+        bool is_replaying() const { return m_Replayer != nullptr; }
+
+        // Index of the last replayed frame (-1 if not replaying)
+        ssize_t replay_frame() const { return m_Replayer ? m_ReplayFrame : -1; }
+
+        // Replayer of the current replay (nullptr if not replaying)
+        TRaisimTrajectoryReplayer* replayer() { return m_Replayer.get(); }
+
+        const TRaisimTrajectoryReplayer* replayer() const { return m_Replayer.get(); }
+
+        // Returns the adapter of the single-body with given name (nullptr if not found)
+        TRaisimSingleBodyAdapter* GetSingleBodyAdapterByName( const std::string& body_name );
+
+        // Returns the adapter of the compound with given name (nullptr if not found)
+        TRaisimCompoundAdapter* GetCompoundAdapterByName( const std::string& compound_name );
+
+        // Sets the urdf file the kintree with given name is built from (must be called before initializing). Kintrees
+        // without a model file aren't simulated
+        bool SetKintreeModelFile( const std::string& kintree_name, const std::string& model_filepath );
+
+        // Returns the adapter of the kintree with given name (nullptr if not found)
+        TRaisimKinematicTreeAdapter* GetKintreeAdapterByName( const std::string& kintree_name );
+
+        // Whether or not there's a kintree with given name (silent lookup, unlike GetKintreeAdapterByName)
+        bool HasKintree( const std::string& kintree_name ) const { return m_KintreeAdaptersMap.find( kintree_name ) != m_KintreeAdaptersMap.end(); }
+
+        std::vector<TRaisimKinematicTreeAdapter*> kintree_adapters();
+
+        // Writes the link-frames of all kintrees into dst_frames as a [num-kintrees, max_num_links(), 7] buffer (and
+        // optionally their velocities into dst_velocities as [num-kintrees, max_num_links(), 6]). Unused slots are zeroed
+        void GetKintreesLinkFrames( double* dst_frames, double* dst_velocities = nullptr ) const;
+
+        // Largest number of links among all kintrees (stride used by the batched link-frames buffers)
+        ssize_t max_num_links() const { return m_MaxNumLinks; }
+
+        // Creates a batched dynamics-query for the kintrees with given names (all kintrees if empty) and frames
+        std::unique_ptr<TRaisimKintreesDynamicsQuery> CreateKintreesDynamicsQuery( const std::vector<std::string>& kintree_names,
+                                                                                    const std::vector<std::string>& frame_names );
+
+        // Sets the number of threads used by batched queries of this simulation (<= 0 for all hardware threads)
+        void SetNumWorkerThreads( ssize_t num_threads );
+
+        TRaisimThreadPool* thread_pool() { return m_ThreadPool.get(); }
+
+        TRaisimJointController& joint_controller() { return m_JointController; }
+
+        const TRaisimJointController& joint_controller() const { return m_JointController; }
+
+        // Timings of each step-phase (only collected if built with LOCO_RAISIM_USE_PROFILING, zeros otherwise)
+        TRaisimStepStats step_stats() const;
+
+        void ResetStepStats();
+
+        // Reports the memory used by this simulation's raisim world, per object-type, buffer-kind and asset
+        TRaisimMemoryReport GetMemoryReport() const;
+
     protected :
 
         bool _InitializeInternal() override;
@@ -41,15 +199,70 @@ namespace raisimlib {
 
         void _CollectSingleBodyAdapters();
 
-        //// void _CollectCompoundAdapters();
+        void _CollectCompoundAdapters();
+
+        void _CollectKintreeAdapters();
+
+        // Accumulates the sync-time spent by the base simulation since the last backend phase ended
+        void _TimingBeginPhase();
 
-        //// void _CollectKintreeAdapters();
+        void _TimingEndPhase();
 
         //// void _CollectTerrainGeneratorAdapters();
 
     private :
 
+        // Arena where all adapters of this world are placed (declared first, so it's destroyed last)
+        TRaisimArena m_Arena;
         std::unique_ptr<raisim::World> m_RaisimWorld;
+        // Whether or not single-bodies are handled by the batch-object instead of through their adapters
+        bool m_BatchSingleBodies;
+        // Batch-object for all single-bodies in the scenario (only used if batching single-bodies)
+        TRaisimSingleBodyBatch m_SingleBodyBatch;
+        // Whether or not static single-bodies are merged into static compounds
+        bool m_MergeStaticBodies;
+        // Merger for the static single-bodies in the scenario (only used if merging static bodies)
+        TRaisimStaticMerger m_StaticMerger;
+        // Adapters of the single-bodies handled by the backend itself when batched (kept out of the base adapters,
+        // so these are never dispatched to)
+        std::vector<std::unique_ptr<TRaisimSingleBodyAdapter>> m_BackendSingleBodyAdapters;
+        // Precompiled scene the single-bodies are built from (only if loaded before initializing)
+        std::unique_ptr<TRaisimSceneFile> m_SceneFile;
+        // File-sources of the heights of heightfield single-bodies (keyed by body name)
+        std::unordered_map<std::string, std::unique_ptr<TRaisimHfieldFileSource>> m_HfieldSources;
+        // Pool of objects that can be spawned|despawned at runtime (not part of the scenario)
+        TRaisimBodyPool m_BodyPool;
+        // Recorder streaming the state of the world into a file after each step (only if recording)
+        std::unique_ptr<TRaisimTrajectoryRecorder> m_Recorder;
+        // Replayer driving the world from a recording instead of integrating it (only if replaying)
+        std::unique_ptr<TRaisimTrajectoryReplayer> m_Replayer;
+        // Index of the last replayed frame
+        ssize_t m_ReplayFrame;
+        // Lookup-table for the raisim single-body adapters (keyed by body name)
+        std::unordered_map<std::string, TRaisimSingleBodyAdapter*> m_SingleBodyAdaptersMap;
+        // Contact-sensors attached to single-bodies, reduced after each step
+        TRaisimContactSensors m_ContactSensors;
+        // Adapters for the compounds in the scenario (one raisim compound-object each)
+        std::vector<std::unique_ptr<TRaisimCompoundAdapter>> m_CompoundAdapters;
+        // Lookup-table for the compound adapters (keyed by compound name)
+        std::unordered_map<std::string, TRaisimCompoundAdapter*> m_CompoundAdaptersMap;
+        // Adapters for the kintrees in the scenario (one raisim articulated-system each)
+        std::vector<std::unique_ptr<TRaisimKinematicTreeAdapter>> m_KintreeAdapters;
+        // Lookup-table for the kintree adapters (keyed by kintree name)
+        std::unordered_map<std::string, TRaisimKinematicTreeAdapter*> m_KintreeAdaptersMap;
+        // Batched pd-controller for the joints of all kintrees
+        TRaisimJointController m_JointController;
+        // Largest number of links among all kintrees
+        ssize_t m_MaxNumLinks;
+        // Worker threads used by batched queries (sequential if not set)
+        std::unique_ptr<TRaisimThreadPool> m_ThreadPool;
+        // Accumulators for the timings of each step-phase
+        TRaisimTimingAccumulator m_TimingSimStep;
+        TRaisimTimingAccumulator m_TimingPostStep;
+        TRaisimTimingAccumulator m_TimingSync;
+        // End of the last backend phase, and time spent syncing so far in the current step
+        std::chrono::steady_clock::time_point m_TimingPhaseEnd;
+        int64_t m_TimingSyncNs;
 
     };
 
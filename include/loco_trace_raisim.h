@@ -0,0 +1,126 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace loco {
+namespace raisimlib {
+
+    // A traced scope, stored as a chrome-trace "complete" event (begin timestamp plus duration)
+    struct TRaisimTraceEvent
+    {
+        // Name of the scope (must be a string with static lifetime, e.g. a literal)
+        const char* name;
+        // Object the scope worked on (e.g. the raisim-world being stepped), shown as an argument in the viewer
+        const void* context;
+        // Begin timestamp (w.r.t. the recorder's epoch) and duration of the scope
+        int64_t begin_ns;
+        int64_t duration_ns;
+    };
+
+    // Ring-buffer of trace events written by a single thread. Only the owner thread writes, and readers
+    // just snapshot the last written entries, so recording never takes locks
+    struct TRaisimTraceThreadBuffer
+    {
+        // Storage for the events (capacity is a power of two)
+        std::unique_ptr<TRaisimTraceEvent[]> events;
+        uint64_t capacity_mask;
+        // Total number of events written so far (the ring keeps the last capacity_mask + 1 ones)
+        std::atomic<uint64_t> head;
+        // Sequential id of the owner thread (used as "tid" in the trace)
+        ssize_t thread_index;
+    };
+
+    // Process-wide recorder of the traced scopes of all threads
+    class TRaisimTraceRecorder
+    {
+    public :
+
+        static TRaisimTraceRecorder& GetInstance();
+
+        // Starts recording, keeping the last events_per_thread events of each thread (rounded up to a power of two)
+        void Enable( ssize_t events_per_thread = 1 << 16 );
+
+        void Disable();
+
+        bool enabled() const { return m_Enabled.load( std::memory_order_relaxed ); }
+
+        // Drops all recorded events (should be called while no thread is recording)
+        void Clear();
+
+        // Writes the recorded events of all threads as chrome-trace json (chrome://tracing, ui.perfetto.dev). Can be
+        // called while threads keep recording, in which case each thread contributes its last (capacity - 1) events
+        bool DumpChromeTrace( const std::string& filepath ) const;
+
+        std::string ToChromeTraceJson() const;
+
+        void Record( const char* name, const void* context, int64_t begin_ns, int64_t duration_ns );
+
+        // Nanoseconds elapsed since the recorder was created
+        int64_t now_ns() const
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - m_Epoch ).count();
+        }
+
+    private :
+
+        TRaisimTraceRecorder();
+
+        TRaisimTraceThreadBuffer* _GetThreadBuffer();
+
+    private :
+
+        // Whether or not scopes are being recorded
+        std::atomic<bool> m_Enabled;
+        // Capacity for the buffers of threads that start recording from now on
+        ssize_t m_EventsPerThread;
+        // Reference time for all timestamps
+        std::chrono::steady_clock::time_point m_Epoch;
+        // Buffers of all threads that have recorded so far (kept alive after their threads exit)
+        std::vector<std::unique_ptr<TRaisimTraceThreadBuffer>> m_ThreadBuffers;
+        mutable std::mutex m_ThreadBuffersMutex;
+    };
+
+    // Records the scope it lives in, if the recorder is enabled
+    class TRaisimTraceScope
+    {
+    public :
+
+        TRaisimTraceScope( const char* name, const void* context )
+            : m_Name( name ), m_Context( context ), m_BeginNs( -1 )
+        {
+            auto& recorder = TRaisimTraceRecorder::GetInstance();
+            if ( recorder.enabled() )
+                m_BeginNs = recorder.now_ns();
+        }
+
+        TRaisimTraceScope( const TRaisimTraceScope& other ) = delete;
+
+        TRaisimTraceScope& operator=( const TRaisimTraceScope& other ) = delete;
+
+        ~TRaisimTraceScope()
+        {
+            if ( m_BeginNs < 0 )
+                return;
+            auto& recorder = TRaisimTraceRecorder::GetInstance();
+            recorder.Record( m_Name, m_Context, m_BeginNs, recorder.now_ns() - m_BeginNs );
+        }
+
+    private :
+
+        const char* m_Name;
+        const void* m_Context;
+        int64_t m_BeginNs;
+    };
+
+}}
+
+#if defined( LOCO_RAISIM_USE_TRACING )
+    #define LOCO_RAISIM_TRACE_SCOPE( name, context ) loco::raisimlib::TRaisimTraceScope _loco_raisim_trace_scope( name, context )
+#else
+    #define LOCO_RAISIM_TRACE_SCOPE( name, context ) ((void)0)
+#endif
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <loco_simulation_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // How the actions given to a vectorized simulation are applied to the kintrees of each world
+    enum class eRaisimActionMode
+    {
+        // Generalized forces|torques (num_dofs() entries per kintree)
+        GENERALIZED_FORCES = 0,
+        // Targets of raisim's joint pd-controller (num_generalized_coordinates() entries per kintree)
+        PD_TARGETS
+    };
+
+    // Kinds of predicates used to detect terminal states of a world
+    enum class eRaisimTerminationType
+    {
+        // Height of a body (or kintree base) goes below the threshold
+        BODY_BELOW_HEIGHT = 0,
+        // Angle (in radians) between a body's (or kintree base's) z-axis and the world z-axis goes above the threshold
+        BODY_TILT_ABOVE,
+        // Number of steps since the last reset of the world reaches the threshold
+        TIME_LIMIT
+    };
+
+    // Termination predicate, resolved to the adapters of a specific world
+    struct TRaisimTerminationCondition
+    {
+        eRaisimTerminationType type;
+        double threshold;
+        // Body (or kintree) checked by the predicate (unused for time-limits)
+        TRaisimSingleBodyAdapter* body_adapter_ref;
+        TRaisimKinematicTreeAdapter* kintree_adapter_ref;
+    };
+
+    // Set of independent raisim worlds (one per scenario, all with the same layout) stepped together on a
+    // thread-pool. Actions, observations and done-flags are exchanged through contiguous row-major buffers
+    // (one row per world), so a whole batch is handled with a single call. Per-world observations are:
+    //     * for each dynamic single-body (in scenario order) : [x, y, z, qw, qx, qy, qz, vx, vy, vz, wx, wy, wz]
+    //     * for each kintree (in scenario order)             : [generalized-coordinates, generalized-velocities]
+    class TRaisimVectorizedSimulation
+    {
+    public :
+
+        // Creates and initializes one simulation per scenario (scenarios must outlive this object), whose steps
+        // run on num_threads threads (<= 0 for all hardware threads). Kintrees are built from the urdf files given
+        // in kintree_model_files (keyed by kintree name)
+        TRaisimVectorizedSimulation( const std::vector<TScenario*>& scenarios,
+                                     ssize_t num_threads,
+                                     const eRaisimActionMode& action_mode = eRaisimActionMode::GENERALIZED_FORCES,
+                                     const std::unordered_map<std::string, std::string>& kintree_model_files = {} );
+
+        TRaisimVectorizedSimulation( const TRaisimVectorizedSimulation& other ) = delete;
+
+        TRaisimVectorizedSimulation& operator=( const TRaisimVectorizedSimulation& other ) = delete;
+
+        ~TRaisimVectorizedSimulation();
+
+        // Applies the given actions (num_worlds() x action_dim(), or nullptr to keep the previous ones), steps all
+        // worlds in parallel, and writes the resulting observations and done-flags into the output buffers
+        void Step( const double* actions );
+
+        // Resets all worlds and writes their initial observations
+        void Reset();
+
+        // Adds a termination predicate (evaluated on every world after each step) that checks the single-body or
+        // kintree with given name (ignored for time-limits). Returns false if the target can't be found
+        bool AddTerminationCondition( const eRaisimTerminationType& type, const std::string& target_name, double threshold );
+
+        // Whether terminated worlds are reset (from their snapshot) within the same step (enabled by default)
+        void SetAutoReset( bool auto_reset ) { m_AutoReset = auto_reset; }
+
+        // Stores the current state of every world as the state terminated worlds are reset to (taken on creation)
+        void SaveSnapshot();
+
+        ssize_t num_worlds() const { return m_Simulations.size(); }
+
+        ssize_t observation_dim() const { return m_ObservationDim; }
+
+        ssize_t action_dim() const { return m_ActionDim; }
+
+        eRaisimActionMode action_mode() const { return m_ActionMode; }
+
+        // Observations of all worlds (num_worlds() x observation_dim(), row-major), overwritten on each step
+        const double* observations() const { return m_Observations.data(); }
+
+        // Done-flags of all worlds (num_worlds() entries), overwritten on each step
+        const uint8_t* dones() const { return m_Dones.data(); }
+
+        // Observations of the worlds that terminated on the last step, before being auto-reset (same layout as
+        // observations(), only the rows of worlds flagged as done are valid)
+        const double* terminal_observations() const { return m_TerminalObservations.data(); }
+
+        // Number of steps taken by each world since its last reset
+        const int64_t* episode_steps() const { return m_EpisodeSteps.data(); }
+
+        TRaisimSimulation* simulation( ssize_t world_index ) { return m_Simulations[world_index].get(); }
+
+        const TRaisimSimulation* simulation( ssize_t world_index ) const { return m_Simulations[world_index].get(); }
+
+        // Memory used by all worlds of this set
+        TRaisimMemoryReport GetMemoryReport() const;
+
+    private :
+
+        void _ApplyActions( ssize_t world_index, const double* actions );
+
+        void _CollectObservations( ssize_t world_index );
+
+        // Writes the state of a world with the same layout as its observations (which cover its whole dynamic state)
+        void _CollectState( ssize_t world_index, double* dst_state ) const;
+
+        void _RestoreState( ssize_t world_index, const double* state );
+
+        bool _IsTerminated( ssize_t world_index ) const;
+
+    private :
+
+        // Simulations of each world (single-bodies are batched, so their states are exchanged through the
+        // batch-object), and the references to the kintree adapters used for observations|actions
+        std::vector<std::unique_ptr<TRaisimSimulation>> m_Simulations;
+        std::vector<std::vector<TRaisimKinematicTreeAdapter*>> m_KintreesAdapters;
+        // Threads used to step the worlds in parallel
+        std::unique_ptr<TRaisimThreadPool> m_ThreadPool;
+        // Layout of the buffers exchanged with the user
+        eRaisimActionMode m_ActionMode;
+        ssize_t m_ObservationDim;
+        ssize_t m_ActionDim;
+        // Output buffers (observations and done-flags of all worlds)
+        std::vector<double> m_Observations;
+        std::vector<uint8_t> m_Dones;
+        std::vector<double> m_TerminalObservations;
+        // Termination predicates of each world, and number of steps since each world was reset
+        std::vector<std::vector<TRaisimTerminationCondition>> m_TerminationConditions;
+        std::vector<int64_t> m_EpisodeSteps;
+        // States the worlds are reset to when terminated (num_worlds() x observation_dim())
+        std::vector<double> m_Snapshots;
+        bool m_AutoReset;
+    };
+
+}}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Raisim object created up-front by the body-pool, either parked (not simulated) or spawned
+    struct TRaisimPooledBody
+    {
+        // Reference to the raisim single-body object (owned by the world)
+        raisim::SingleBodyObject* raisim_body;
+        // Index of the pool (shape) this object belongs to
+        ssize_t pool_index;
+        // Whether the object is currently spawned
+        bool active;
+    };
+
+    // Objects of a given collision-shape (type and size) and mass held by the body-pool
+    struct TRaisimShapePool
+    {
+        eShapeType type;
+        TVec3 size;
+        // Mass of the objects (the one given by the user, or computed from the shape's volume if not given)
+        double mass;
+        // Handles of the parked objects of this shape, ready to be spawned
+        std::vector<ssize_t> free_handles;
+    };
+
+    // Pool of raisim single-body objects created before they're needed (e.g. projectiles, debris), so that bodies
+    // can be spawned|despawned at runtime with just a pose|state write. Parked objects are static, have their
+    // collision-geom disabled and are placed out of the way, so the solver never sees them
+    class TRaisimBodyPool
+    {
+    public :
+
+        TRaisimBodyPool();
+
+        TRaisimBodyPool( const TRaisimBodyPool& other ) = delete;
+
+        TRaisimBodyPool& operator=( const TRaisimBodyPool& other ) = delete;
+
+        ~TRaisimBodyPool();
+
+        // Creates num_bodies parked objects with the given collision-shape and mass (only primitive shapes are supported)
+        bool Reserve( const TShapeData& shape_data, const TInertialData& inertia_data, ssize_t num_bodies );
+
+        // Activates a parked object of the given shape and mass at the given pose and velocity, returning its handle
+        // (-1 if there's no pool for that shape and mass, or all its objects are already spawned)
+        ssize_t Spawn( const TShapeData& shape_data,
+                       const TInertialData& inertia_data,
+                       const TMat4& transform,
+                       const TVec3& linear_vel,
+                       const TVec3& angular_vel );
+
+        // Parks back the object with given handle, returning false if it wasn't spawned
+        bool Despawn( ssize_t handle );
+
+        // Parks back all spawned objects
+        void DespawnAll();
+
+        void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
+
+        raisim::SingleBodyObject* raisim_body( ssize_t handle ) { return m_Bodies[handle].raisim_body; }
+
+        const raisim::SingleBodyObject* raisim_body( ssize_t handle ) const { return m_Bodies[handle].raisim_body; }
+
+        bool is_active( ssize_t handle ) const { return ( handle >= 0 && handle < m_Bodies.size() && m_Bodies[handle].active ); }
+
+        ssize_t num_bodies() const { return m_Bodies.size(); }
+
+        ssize_t num_active() const { return m_NumActive; }
+
+    private :
+
+        // Returns the index of the pool holding objects of the given shape and mass (-1 if none)
+        ssize_t _FindPool( const TShapeData& shape_data, double mass ) const;
+
+        void _Park( TRaisimPooledBody& pooled_body );
+
+    private :
+
+        // Reference to the raisim-world, used to create the pooled objects
+        raisim::World* m_RaisimWorldRef;
+        // All pooled objects (handles index into this container)
+        std::vector<TRaisimPooledBody> m_Bodies;
+        // Pools of parked objects, one per collision-shape
+        std::vector<TRaisimShapePool> m_Pools;
+        // Number of currently spawned objects
+        ssize_t m_NumActive;
+    };
+
+}}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <loco_common_raisim.h>
+#include <loco_arena_raisim.h>
+#include <loco_hfield_source_raisim.h>
 #include <primitives/loco_single_body_collider_adapter_raisim.h>
 #include <primitives/loco_single_body_adapter.h>
 
@@ -11,6 +13,17 @@ namespace loco {
 namespace loco {
 namespace raisimlib {
 
+    class TRaisimSceneFile;
+
+    // Creates the raisim object of the given single-body (dynamics type included), taking it from the precompiled
+    // scene if it has a record of the body, from the file-source of its heights if it's a heightfield with one,
+    // or from its collider data otherwise (scene file and hfield source can be nullptr). Shared by the adapter and
+    // the single-body batch
+    raisim::SingleBodyObject* BuildSingleBody( raisim::World* raisim_world,
+                                               TSingleBody* body_ref,
+                                               const TRaisimSceneFile* scene_file_ref,
+                                               const TRaisimHfieldFileSource* hfield_source_ref );
+
     class TRaisimSingleBodyAdapter : public TISingleBodyAdapter
     {
     public :
@@ -21,6 +34,9 @@ namespace raisimlib {
 
         TRaisimSingleBodyAdapter& operator=( const TRaisimSingleBodyAdapter& other ) = delete;
 
+        // Adapters are placed in the arena of the simulation that owns them
+        LOCO_RAISIM_ARENA_ALLOCATED( TRaisimSingleBodyAdapter )
+
         ~TRaisimSingleBodyAdapter();
 
         void Build() override;
@@ -49,6 +65,15 @@ namespace raisimlib {
 
         void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
 
+        // Precompiled scene to build the raisim object from, if it has a record for this body (nullptr to unset)
+        void SetSceneFile( const TRaisimSceneFile* scene_file_ref ) { m_SceneFileRef = scene_file_ref; }
+
+        // Binary file to read the heights from, if this body is a heightfield (nullptr to use its collider data)
+        void SetHfieldSource( const TRaisimHfieldFileSource* hfield_source_ref ) { m_HfieldSourceRef = hfield_source_ref; }
+
+        // Links this adapter to a raisim object built elsewhere (used when single-bodies are handled in batch)
+        void SetRaisimBody( raisim::SingleBodyObject* raisim_body_ref ) { m_RaisimBodyRef = raisim_body_ref; }
+
         raisim::SingleBodyObject* raisim_body() { return m_RaisimBodyRef; }
 
         const raisim::SingleBodyObject* raisim_body() const { return m_RaisimBodyRef; }
@@ -65,6 +90,10 @@ namespace raisimlib {
         raisim::World* m_RaisimWorldRef;
         // Reference to-single-object raisim resource (owned by world)
         raisim::SingleBodyObject* m_RaisimBodyRef;
+        // Reference to the precompiled scene used for building (owned by the simulation, optional)
+        const TRaisimSceneFile* m_SceneFileRef;
+        // Reference to the file-source of the heights, for heightfields (owned by the simulation, optional)
+        const TRaisimHfieldFileSource* m_HfieldSourceRef;
     };
 
 }}
\ No newline at end of file
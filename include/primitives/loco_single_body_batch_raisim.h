@@ -0,0 +1,101 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+#include <loco_hfield_source_raisim.h>
+
+namespace loco {
+    class TSingleBody;
+}
+
+namespace loco {
+namespace raisimlib {
+
+    class TRaisimSingleBodyColliderAdapter;
+    class TRaisimSceneFile;
+
+    // Manages all single-bodies of a world at once, keeping their raisim objects and initial state in contiguous
+    // arrays, so that build, initialize, reset and state-sync are plain loops instead of per-body virtual calls
+    class TRaisimSingleBodyBatch
+    {
+    public :
+
+        TRaisimSingleBodyBatch();
+
+        TRaisimSingleBodyBatch( const TRaisimSingleBodyBatch& other ) = delete;
+
+        TRaisimSingleBodyBatch& operator=( const TRaisimSingleBodyBatch& other ) = delete;
+
+        ~TRaisimSingleBodyBatch();
+
+        // Registers a single-body (and the adapter of its collider), returning its index in the batch
+        ssize_t Add( TSingleBody* body_ref, TRaisimSingleBodyColliderAdapter* collider_adapter_ref );
+
+        // Binary file to read the heights of the given (heightfield) body from (nullptr to use its collider data)
+        void SetHfieldSource( ssize_t index, const TRaisimHfieldFileSource* hfield_source_ref ) { m_HfieldSourcesRefs[index] = hfield_source_ref; }
+
+        // Creates the raisim objects of all registered single-bodies
+        void Build();
+
+        // Caches the initial state of all single-bodies, sets up their colliders and places them in that state
+        void Initialize();
+
+        // Places all single-bodies back in their initial state
+        void Reset();
+
+        // Writes the state of the dynamic single-bodies (in registration order) into dst_states as a
+        // [num_dynamic_bodies(), 13] buffer, with rows given by [position (3), quaternion wxyz (4),
+        // linear-velocity (3), angular-velocity (3)]. Static bodies have no state, so they're skipped
+        void GetStates( double* dst_states ) const;
+
+        // Sets the state of the dynamic single-bodies from a [num_dynamic_bodies(), 13] buffer (same layout as GetStates)
+        void SetStates( const double* states );
+
+        void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
+
+        // Precompiled scene to build the raisim objects from, for the bodies it has records of (nullptr to unset)
+        void SetSceneFile( const TRaisimSceneFile* scene_file_ref ) { m_SceneFileRef = scene_file_ref; }
+
+        // Bytes used by the arrays of the batch (excluding the raisim objects themselves)
+        size_t memory_bytes() const;
+
+        ssize_t num_bodies() const { return m_BodiesRefs.size(); }
+
+        ssize_t num_dynamic_bodies() const { return m_DynamicIndices.size(); }
+
+        TSingleBody* body( ssize_t index ) { return m_BodiesRefs[index]; }
+
+        const TSingleBody* body( ssize_t index ) const { return m_BodiesRefs[index]; }
+
+        raisim::SingleBodyObject* raisim_body( ssize_t index ) { return m_RaisimBodiesRefs[index]; }
+
+        const raisim::SingleBodyObject* raisim_body( ssize_t index ) const { return m_RaisimBodiesRefs[index]; }
+
+        // Number of values per single-body in the states buffers
+        static constexpr ssize_t STATE_DIM = 13;
+
+    private :
+
+        // Reference to the raisim-world, used to create all simulation-related objects
+        raisim::World* m_RaisimWorldRef;
+        // Reference to the precompiled scene used for building (owned by the simulation, optional)
+        const TRaisimSceneFile* m_SceneFileRef;
+        // References to the loco single-bodies (owned by the scenario)
+        std::vector<TSingleBody*> m_BodiesRefs;
+        // References to the collider adapters of each single-body (owned by the simulation)
+        std::vector<TRaisimSingleBodyColliderAdapter*> m_ColliderAdaptersRefs;
+        // References to the file-sources of the heights of each body (owned by the simulation, nullptr if none)
+        std::vector<const TRaisimHfieldFileSource*> m_HfieldSourcesRefs;
+        // References to the raisim single-body objects (owned by the world)
+        std::vector<raisim::SingleBodyObject*> m_RaisimBodiesRefs;
+        // Initial state of each single-body, cached on initialization
+        std::vector<Eigen::Vector3d> m_InitialPositions;
+        std::vector<Eigen::Matrix3d> m_InitialRotations;
+        std::vector<Eigen::Vector3d> m_InitialLinearVelocities;
+        std::vector<Eigen::Vector3d> m_InitialAngularVelocities;
+        // Whether or not each single-body is dynamic (only these get velocities set)
+        std::vector<uint8_t> m_IsDynamic;
+        // Indices of the dynamic single-bodies (rows of the states buffers)
+        std::vector<ssize_t> m_DynamicIndices;
+    };
+
+}}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <loco_common_raisim.h>
+#include <loco_arena_raisim.h>
 #include <primitives/loco_single_body_collider_adapter.h>
 
 namespace loco {
@@ -16,6 +17,9 @@ namespace raisimlib {
 
         TRaisimSingleBodyColliderAdapter& operator=( const TRaisimSingleBodyColliderAdapter& other ) = delete;
 
+        // Adapters are placed in the arena of the simulation that owns them
+        LOCO_RAISIM_ARENA_ALLOCATED( TRaisimSingleBodyColliderAdapter )
+
         ~TRaisimSingleBodyColliderAdapter();
 
         void Build() override;
@@ -32,6 +36,12 @@ namespace raisimlib {
 
         void ChangeCollisionMask( int collisionMask ) override;
 
+        // Returns the terrain heights at the xy-coordinates of the given points (hfield colliders only)
+        std::vector<double> SampleHeights( const std::vector<TVec3>& points ) const;
+
+        // Writes the terrain heights at the xy-coordinates of the given xyz-points into dst_heights (hfield colliders only)
+        void SampleHeights( const double* points_xyz, ssize_t num_points, double* dst_heights ) const;
+
         void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
 
         void SetRaisimBody( raisim::SingleBodyObject* raisim_body_ref ) { m_RaisimBodyRef = raisim_body_ref; }
@@ -40,6 +50,10 @@ namespace raisimlib {
 
         const dGeomID ode_geom() const { return m_RaisimOdeGeom; }
 
+        raisim::HeightMap* raisim_hmap() { return m_RaisimHeightMapRef; }
+
+        const raisim::HeightMap* raisim_hmap() const { return m_RaisimHeightMapRef; }
+
     private :
 
         // Reference to the raisim-world, used to create all simulation-related objects
@@ -48,6 +62,8 @@ namespace raisimlib {
         dGeomID m_RaisimOdeGeom;
         // Reference to-single-object raisim resource (owned by world)
         raisim::SingleBodyObject* m_RaisimBodyRef;
+        // Reference to the raisim-heightmap resource, if the collider is a hfield (owned by world)
+        raisim::HeightMap* m_RaisimHeightMapRef;
     };
 
 }}
\ No newline at end of file
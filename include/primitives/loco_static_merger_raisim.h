@@ -0,0 +1,86 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+    class TSingleBody;
+}
+
+namespace loco {
+namespace raisimlib {
+
+    // Static raisim compound created by the merger from the static single-bodies in a region of the scene
+    struct TRaisimMergedStaticGroup
+    {
+        // Reference to the raisim compound-object (owned by the world)
+        raisim::Compound* raisim_compound;
+        // Indices (in the merger) of the single-bodies that were merged into this compound
+        std::vector<ssize_t> bodies_indices;
+    };
+
+    // Merges static single-bodies with primitive shapes into a few static raisim compounds (one per cell of a
+    // regular xy-grid), so the broadphase handles a handful of objects instead of one per wall|step|crate
+    class TRaisimStaticMerger
+    {
+    public :
+
+        TRaisimStaticMerger();
+
+        TRaisimStaticMerger( const TRaisimStaticMerger& other ) = delete;
+
+        TRaisimStaticMerger& operator=( const TRaisimStaticMerger& other ) = delete;
+
+        ~TRaisimStaticMerger();
+
+        // Whether or not the given single-body can be merged (static, and with a shape supported by compounds)
+        static bool CanMerge( const TSingleBody* body_ref );
+
+        // Registers a mergeable single-body, returning its index in the merger
+        ssize_t Add( TSingleBody* body_ref );
+
+        // Creates the merged compounds (bodies keep their initial pose, as they never move)
+        void Build();
+
+        // Returns the index of the merged single-body with given name (-1 if it wasn't merged)
+        ssize_t FindBody( const std::string& body_name ) const;
+
+        // Returns the index of the merged single-body with given child index in the given compound (e.g. to map
+        // contacts back to loco bodies), or -1 if that's not a merged compound
+        ssize_t FindBody( const raisim::Object* raisim_object, ssize_t child_index ) const;
+
+        // Size of the xy-cells used to group static bodies (must be set before building)
+        void SetCellSize( double cell_size ) { m_CellSize = cell_size; }
+
+        void SetRaisimWorld( raisim::World* raisim_world_ref ) { m_RaisimWorldRef = raisim_world_ref; }
+
+        // Compound that holds the merged single-body with given index, and the index of its shape in there
+        raisim::Compound* raisim_compound( ssize_t index ) { return m_Groups[m_BodiesGroups[index]].raisim_compound; }
+
+        const raisim::Compound* raisim_compound( ssize_t index ) const { return m_Groups[m_BodiesGroups[index]].raisim_compound; }
+
+        ssize_t child_index( ssize_t index ) const { return m_BodiesChildren[index]; }
+
+        TSingleBody* body( ssize_t index ) { return m_BodiesRefs[index]; }
+
+        const TSingleBody* body( ssize_t index ) const { return m_BodiesRefs[index]; }
+
+        ssize_t num_bodies() const { return m_BodiesRefs.size(); }
+
+        const std::vector<TRaisimMergedStaticGroup>& groups() const { return m_Groups; }
+
+    private :
+
+        // Reference to the raisim-world, used to create the merged compounds
+        raisim::World* m_RaisimWorldRef;
+        // Size of the xy-cells used to group static bodies
+        double m_CellSize;
+        // References to the merged single-bodies (owned by the scenario)
+        std::vector<TSingleBody*> m_BodiesRefs;
+        // Group and child (shape index in the compound) of each merged single-body
+        std::vector<ssize_t> m_BodiesGroups;
+        std::vector<ssize_t> m_BodiesChildren;
+        // Merged compounds, one per non-empty cell
+        std::vector<TRaisimMergedStaticGroup> m_Groups;
+    };
+
+}}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <loco_common_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    class TRaisimSingleBodyAdapter;
+
+    // Net contact wrench (world-frame, about the body's com) and number of contacts on a sensed body
+    struct TRaisimContactReading
+    {
+        // Net contact force acting on the body
+        double force[3];
+        // Net contact torque acting on the body, w.r.t. its center of mass
+        double torque[3];
+        // Number of (non-skipped) contacts involving the body
+        ssize_t num_contacts;
+    };
+
+    class TRaisimContactSensors
+    {
+    public :
+
+        TRaisimContactSensors() = default;
+
+        TRaisimContactSensors( const TRaisimContactSensors& other ) = delete;
+
+        TRaisimContactSensors& operator=( const TRaisimContactSensors& other ) = delete;
+
+        ~TRaisimContactSensors() = default;
+
+        // Registers a sensor on the body handled by the given adapter, and returns its slot in the readings buffer
+        ssize_t AddSensor( TRaisimSingleBodyAdapter* body_adapter_ref );
+
+        // Reduces the contacts of the last integration step into the readings of each sensor (no allocations)
+        void Update( double time_step );
+
+        // Clears all readings
+        void Reset();
+
+        ssize_t num_sensors() const { return m_Readings.size(); }
+
+        const TRaisimContactReading& reading( ssize_t index ) const { return m_Readings[index]; }
+
+        // Contiguous buffer with the readings of all sensors (num_sensors() entries)
+        const TRaisimContactReading* readings() const { return m_Readings.data(); }
+
+    private :
+
+        // References to the adapters of the sensed bodies (raisim resources are grabbed on each update)
+        std::vector<TRaisimSingleBodyAdapter*> m_BodyAdaptersRefs;
+        // Contiguous storage for the readings of all sensors
+        std::vector<TRaisimContactReading> m_Readings;
+    };
+
+}}
@@ -0,0 +1,411 @@
+#include <loco_simulation_raisim.h>
+#include <loco_vectorized_raisim.h>
+#include <loco_allocs_raisim.h>
+#include <loco_trace_raisim.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace loco {
+namespace raisimlib {
+
+    // Grabs the raisim-backend of a simulation created through loco's runtime
+    TRaisimSimulation* ToRaisimSimulation( TISimulation* simulation )
+    {
+        auto raisim_simulation = dynamic_cast<TRaisimSimulation*>( simulation );
+        if ( !raisim_simulation )
+            throw std::runtime_error( "loco_raisim >>> given simulation doesn't use the raisim backend" );
+        return raisim_simulation;
+    }
+
+    void bindings_profiling( py::module& m )
+    {
+        py::class_<TRaisimTimingStats>( m, "TimingStats" )
+            .def_readonly( "count", &TRaisimTimingStats::count )
+            .def_readonly( "mean", &TRaisimTimingStats::mean )
+            .def_readonly( "p50", &TRaisimTimingStats::p50 )
+            .def_readonly( "p99", &TRaisimTimingStats::p99 )
+            .def_readonly( "max", &TRaisimTimingStats::max )
+            .def( "__repr__", []( const TRaisimTimingStats& self )
+                {
+                    return "TimingStats(count=" + std::to_string( self.count ) + ", mean=" + std::to_string( self.mean ) +
+                           "ns, p50=" + std::to_string( self.p50 ) + "ns, p99=" + std::to_string( self.p99 ) +
+                           "ns, max=" + std::to_string( self.max ) + "ns)";
+                } );
+
+        py::class_<TRaisimStepStats>( m, "StepStats" )
+            .def_readonly( "sim_step", &TRaisimStepStats::sim_step )
+            .def_readonly( "post_step", &TRaisimStepStats::post_step )
+            .def_readonly( "sync", &TRaisimStepStats::sync );
+
+        m.def( "GetStepStats", []( TISimulation* simulation )
+            {
+                return ToRaisimSimulation( simulation )->step_stats();
+            } );
+        m.def( "ResetStepStats", []( TISimulation* simulation )
+            {
+                ToRaisimSimulation( simulation )->ResetStepStats();
+            } );
+    #if defined( LOCO_RAISIM_USE_PROFILING )
+        m.attr( "PROFILING_ENABLED" ) = true;
+    #else
+        m.attr( "PROFILING_ENABLED" ) = false;
+    #endif
+    }
+
+    void bindings_tracing( py::module& m )
+    {
+        m.def( "EnableTracing", []( ssize_t events_per_thread )
+            {
+                TRaisimTraceRecorder::GetInstance().Enable( events_per_thread );
+            }, py::arg( "events_per_thread" ) = 1 << 16 );
+        m.def( "DisableTracing", []() { TRaisimTraceRecorder::GetInstance().Disable(); } );
+        m.def( "ClearTracing", []() { TRaisimTraceRecorder::GetInstance().Clear(); } );
+        m.def( "DumpChromeTrace", []( const std::string& filepath )
+            {
+                return TRaisimTraceRecorder::GetInstance().DumpChromeTrace( filepath );
+            } );
+    #if defined( LOCO_RAISIM_USE_TRACING )
+        m.attr( "TRACING_ENABLED" ) = true;
+    #else
+        m.attr( "TRACING_ENABLED" ) = false;
+    #endif
+    }
+
+    void bindings_allocs( py::module& m )
+    {
+        // Counters of all tracked types, as {type-name: (live, total_created, total_destroyed)}
+        m.def( "GetAllocCounts", []()
+            {
+                py::dict alloc_counts;
+                for ( ssize_t i = 0; i < (ssize_t)eRaisimAllocType::NUM_TYPES; i++ )
+                {
+                    const auto counts = TRaisimAllocTracker::counts( (eRaisimAllocType)i );
+                    const auto type_name = AllocTypeToString( (eRaisimAllocType)i );
+                    alloc_counts[type_name.c_str()] = py::make_tuple( counts.live, counts.total_created, counts.total_destroyed );
+                }
+                return alloc_counts;
+            } );
+        m.def( "GetAllocsReport", []() { return TRaisimAllocTracker::Report(); } );
+        m.def( "SetAllocBacktraceSampling", []( int64_t sample_every )
+            {
+                TRaisimAllocTracker::SetBacktraceSampling( sample_every );
+            } );
+        m.def( "GetAllocSamples", []()
+            {
+                py::list samples;
+                for ( const auto& sample : TRaisimAllocTracker::samples() )
+                {
+                    py::dict py_sample;
+                    py_sample["type"] = AllocTypeToString( sample.type );
+                    py_sample["created"] = sample.created;
+                    py_sample["address"] = loco::PointerToHexAddress( sample.address );
+                    py_sample["backtrace"] = sample.backtrace;
+                    samples.append( py_sample );
+                }
+                return samples;
+            } );
+        m.def( "ClearAllocSamples", []() { TRaisimAllocTracker::ClearSamples(); } );
+    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
+        m.attr( "TRACK_ALLOCS_ENABLED" ) = true;
+    #else
+        m.attr( "TRACK_ALLOCS_ENABLED" ) = false;
+    #endif
+    }
+
+    void bindings_memory( py::module& m )
+    {
+        py::class_<TRaisimAssetMemory>( m, "AssetMemory" )
+            .def_readonly( "name", &TRaisimAssetMemory::name )
+            .def_readonly( "type", &TRaisimAssetMemory::type )
+            .def_readonly( "bytes", &TRaisimAssetMemory::bytes );
+
+        py::class_<TRaisimMemoryReport>( m, "MemoryReport" )
+            .def( py::init<>() )
+            .def_readonly( "num_worlds", &TRaisimMemoryReport::num_worlds )
+            .def_readonly( "num_objects_per_type", &TRaisimMemoryReport::num_objects_per_type )
+            .def_readonly( "object_bytes_per_type", &TRaisimMemoryReport::object_bytes_per_type )
+            .def_readonly( "hfield_bytes", &TRaisimMemoryReport::hfield_bytes )
+            .def_readonly( "core_hfield_bytes", &TRaisimMemoryReport::core_hfield_bytes )
+            .def_readonly( "hfield_build_copy_bytes", &TRaisimMemoryReport::hfield_build_copy_bytes )
+            .def_readonly( "estimated_mesh_bytes", &TRaisimMemoryReport::estimated_mesh_bytes )
+            .def_readonly( "contact_bytes", &TRaisimMemoryReport::contact_bytes )
+            .def_readonly( "estimated_dynamics_bytes", &TRaisimMemoryReport::estimated_dynamics_bytes )
+            .def_readonly( "adapter_bytes", &TRaisimMemoryReport::adapter_bytes )
+            .def_readonly( "assets", &TRaisimMemoryReport::assets )
+            .def_property_readonly( "object_bytes", &TRaisimMemoryReport::object_bytes )
+            .def_property_readonly( "total_bytes", &TRaisimMemoryReport::total_bytes )
+            .def( "__iadd__", &TRaisimMemoryReport::operator+= )
+            .def( "__repr__", &TRaisimMemoryReport::ToString );
+
+        m.def( "GetMemoryReport", []( TISimulation* simulation )
+            {
+                return ToRaisimSimulation( simulation )->GetMemoryReport();
+            } );
+        m.def( "AggregateMemoryReports", &AggregateMemoryReports );
+    }
+
+    void bindings_kintrees( py::module& m )
+    {
+        // Must be called before the simulation is initialized
+        m.def( "SetKintreeModelFile", []( TISimulation* simulation, const std::string& kintree_name, const std::string& model_filepath )
+            {
+                return ToRaisimSimulation( simulation )->SetKintreeModelFile( kintree_name, model_filepath );
+            }, py::arg( "simulation" ), py::arg( "kintree_name" ), py::arg( "model_filepath" ) );
+    }
+
+    void bindings_pool( py::module& m )
+    {
+        m.def( "ReservePooledBodies", []( TISimulation* simulation, const TCollisionData& shape_data,
+                                          const TInertialData& inertia_data, ssize_t num_bodies )
+            {
+                return ToRaisimSimulation( simulation )->ReservePooledBodies( shape_data, inertia_data, num_bodies );
+            }, py::arg( "simulation" ), py::arg( "shape_data" ), py::arg( "inertia_data" ), py::arg( "num_bodies" ) );
+        m.def( "SpawnBody", []( TISimulation* simulation, const TCollisionData& shape_data, const TInertialData& inertia_data,
+                                const TMat4& transform, const TVec3& linear_vel, const TVec3& angular_vel )
+            {
+                return ToRaisimSimulation( simulation )->SpawnBody( shape_data, inertia_data, transform, linear_vel, angular_vel );
+            }, py::arg( "simulation" ), py::arg( "shape_data" ), py::arg( "inertia_data" ), py::arg( "transform" ),
+               py::arg( "linear_vel" ) = TVec3(), py::arg( "angular_vel" ) = TVec3() );
+        m.def( "DespawnBody", []( TISimulation* simulation, ssize_t handle )
+            {
+                return ToRaisimSimulation( simulation )->DespawnBody( handle );
+            }, py::arg( "simulation" ), py::arg( "handle" ) );
+        m.def( "GetNumSpawnedBodies", []( TISimulation* simulation )
+            {
+                return ToRaisimSimulation( simulation )->body_pool().num_active();
+            } );
+    }
+
+    void bindings_scene_file( py::module& m )
+    {
+        m.def( "SavePrecompiledScene", []( TISimulation* simulation, const std::string& filepath )
+            {
+                return ToRaisimSimulation( simulation )->SavePrecompiledScene( filepath );
+            }, py::arg( "simulation" ), py::arg( "filepath" ) );
+        // Must be called before the simulation is initialized
+        m.def( "LoadPrecompiledScene", []( TISimulation* simulation, const std::string& filepath )
+            {
+                return ToRaisimSimulation( simulation )->LoadPrecompiledScene( filepath );
+            }, py::arg( "simulation" ), py::arg( "filepath" ) );
+    }
+
+    void bindings_hfield_source( py::module& m )
+    {
+        py::enum_<eRaisimHfieldSampleType>( m, "HfieldSampleType" )
+            .value( "FLOAT32", eRaisimHfieldSampleType::FLOAT32 )
+            .value( "INT16", eRaisimHfieldSampleType::INT16 );
+
+        // Must be called before the simulation is initialized
+        m.def( "SetHfieldFileSource", []( TISimulation* simulation, const std::string& body_name, const std::string& filepath,
+                                          ssize_t nx_samples, ssize_t ny_samples, const eRaisimHfieldSampleType& sample_type,
+                                          double scale, double offset, size_t header_bytes )
+            {
+                auto source = TRaisimHfieldFileSource();
+                source.filepath = filepath;
+                source.sample_type = sample_type;
+                source.nx_samples = nx_samples;
+                source.ny_samples = ny_samples;
+                source.header_bytes = header_bytes;
+                source.scale = scale;
+                source.offset = offset;
+                return ToRaisimSimulation( simulation )->SetHfieldFileSource( body_name, source );
+            }, py::arg( "simulation" ), py::arg( "body_name" ), py::arg( "filepath" ), py::arg( "nx_samples" ),
+               py::arg( "ny_samples" ), py::arg( "sample_type" ) = eRaisimHfieldSampleType::FLOAT32,
+               py::arg( "scale" ) = 1.0, py::arg( "offset" ) = 0.0, py::arg( "header_bytes" ) = 0 );
+    }
+
+    void bindings_recorder( py::module& m )
+    {
+        py::enum_<eRaisimRecordingCodec>( m, "RecordingCodec" )
+            .value( "RAW", eRaisimRecordingCodec::RAW )
+            .value( "QUANTIZED", eRaisimRecordingCodec::QUANTIZED );
+
+        py::class_<TRaisimRecordingCompression>( m, "RecordingCompression" )
+            .def( py::init<>() )
+            .def_readwrite( "codec", &TRaisimRecordingCompression::codec )
+            .def_readwrite( "position_resolution", &TRaisimRecordingCompression::position_resolution )
+            .def_readwrite( "velocity_resolution", &TRaisimRecordingCompression::velocity_resolution )
+            .def_readwrite( "force_resolution", &TRaisimRecordingCompression::force_resolution )
+            .def_readwrite( "quaternion_bits", &TRaisimRecordingCompression::quaternion_bits )
+            .def_readwrite( "keyframe_interval", &TRaisimRecordingCompression::keyframe_interval );
+
+        // Must be called after the simulation is initialized
+        m.def( "StartRecording", []( TISimulation* simulation, const std::string& filepath, bool record_contacts,
+                                     const TRaisimRecordingCompression& compression, ssize_t ring_frames, size_t chunk_bytes )
+            {
+                return ToRaisimSimulation( simulation )->StartRecording( filepath, record_contacts, compression, ring_frames, chunk_bytes );
+            }, py::arg( "simulation" ), py::arg( "filepath" ), py::arg( "record_contacts" ) = false,
+               py::arg( "compression" ) = TRaisimRecordingCompression(),
+               py::arg( "ring_frames" ) = 1024, py::arg( "chunk_bytes" ) = 64 * 1024 * 1024 );
+        m.def( "StopRecording", []( TISimulation* simulation )
+            {
+                return ToRaisimSimulation( simulation )->StopRecording();
+            }, py::arg( "simulation" ) );
+        m.def( "GetRecordingStats", []( TISimulation* simulation )
+            {
+                auto recorder = ToRaisimSimulation( simulation )->recorder();
+                auto stats = py::dict();
+                stats["frame_bytes"] = recorder ? recorder->frame_bytes() : 0;
+                stats["num_frames_written"] = recorder ? recorder->num_frames_written() : 0;
+                stats["num_frames_dropped"] = recorder ? recorder->num_frames_dropped() : 0;
+                stats["frames_bytes"] = recorder ? recorder->frames_bytes() : 0;
+                return stats;
+            }, py::arg( "simulation" ) );
+        // Must be called after the simulation is initialized
+        m.def( "StartReplay", []( TISimulation* simulation, const std::string& filepath )
+            {
+                return ToRaisimSimulation( simulation )->StartReplay( filepath );
+            }, py::arg( "simulation" ), py::arg( "filepath" ) );
+        m.def( "SeekReplay", []( TISimulation* simulation, ssize_t frame_index )
+            {
+                return ToRaisimSimulation( simulation )->SeekReplay( frame_index );
+            }, py::arg( "simulation" ), py::arg( "frame_index" ) );
+        m.def( "SeekReplayTime", []( TISimulation* simulation, double time )
+            {
+                auto raisim_simulation = ToRaisimSimulation( simulation );
+                if ( !raisim_simulation->replayer() )
+                    return false;
+                return raisim_simulation->SeekReplay( raisim_simulation->replayer()->FindFrame( time ) );
+            }, py::arg( "simulation" ), py::arg( "time" ) );
+        m.def( "StopReplay", []( TISimulation* simulation )
+            {
+                ToRaisimSimulation( simulation )->StopReplay();
+            }, py::arg( "simulation" ) );
+        m.def( "GetReplayNumFrames", []( TISimulation* simulation )
+            {
+                auto replayer = ToRaisimSimulation( simulation )->replayer();
+                return replayer ? replayer->num_frames() : 0;
+            }, py::arg( "simulation" ) );
+        m.def( "GetReplayFrame", []( TISimulation* simulation )
+            {
+                return ToRaisimSimulation( simulation )->replay_frame();
+            }, py::arg( "simulation" ) );
+    }
+
+    // Numpy views (no copies) of the output buffers of a vectorized simulation, which keep it alive
+    py::array_t<double> ObservationsView( const TRaisimVectorizedSimulation& vec_simulation, const double* buffer, py::handle owner )
+    {
+        const ssize_t obs_dim = vec_simulation.observation_dim();
+        return py::array_t<double>( { vec_simulation.num_worlds(), obs_dim },
+                                    { (ssize_t)( obs_dim * sizeof( double ) ), (ssize_t)sizeof( double ) },
+                                    buffer, owner );
+    }
+
+    py::array_t<double> ObservationsView( const TRaisimVectorizedSimulation& vec_simulation, py::handle owner )
+    {
+        return ObservationsView( vec_simulation, vec_simulation.observations(), owner );
+    }
+
+    py::array_t<bool> DonesView( const TRaisimVectorizedSimulation& vec_simulation, py::handle owner )
+    {
+        static_assert( sizeof( bool ) == sizeof( uint8_t ), "Done-flags are exposed as numpy bool arrays" );
+        return py::array_t<bool>( { vec_simulation.num_worlds() },
+                                  { (ssize_t)sizeof( uint8_t ) },
+                                  reinterpret_cast<const bool*>( vec_simulation.dones() ), owner );
+    }
+
+    void bindings_vectorized( py::module& m )
+    {
+        py::enum_<eRaisimActionMode>( m, "ActionMode" )
+            .value( "GENERALIZED_FORCES", eRaisimActionMode::GENERALIZED_FORCES )
+            .value( "PD_TARGETS", eRaisimActionMode::PD_TARGETS );
+
+        py::enum_<eRaisimTerminationType>( m, "TerminationType" )
+            .value( "BODY_BELOW_HEIGHT", eRaisimTerminationType::BODY_BELOW_HEIGHT )
+            .value( "BODY_TILT_ABOVE", eRaisimTerminationType::BODY_TILT_ABOVE )
+            .value( "TIME_LIMIT", eRaisimTerminationType::TIME_LIMIT );
+
+        py::class_<TRaisimVectorizedSimulation>( m, "VectorizedSimulation" )
+            .def( py::init( []( const std::vector<TScenario*>& scenarios, ssize_t num_threads, const eRaisimActionMode& action_mode,
+                                const std::unordered_map<std::string, std::string>& kintree_model_files )
+                {
+                    py::gil_scoped_release release;
+                    return std::make_unique<TRaisimVectorizedSimulation>( scenarios, num_threads, action_mode, kintree_model_files );
+                } ),
+                py::arg( "scenarios" ), py::arg( "num_threads" ) = -1,
+                py::arg( "action_mode" ) = eRaisimActionMode::GENERALIZED_FORCES,
+                py::arg( "kintree_model_files" ) = std::unordered_map<std::string, std::string>(),
+                py::keep_alive<1, 2>() )
+            // Steps all worlds with the GIL released, returning (observations, dones) as views over the internal
+            // buffers (overwritten by the next call, so copy them if they have to be kept)
+            .def( "Step", []( py::object self, py::object actions )
+                {
+                    auto& vec_simulation = self.cast<TRaisimVectorizedSimulation&>();
+                    py::array_t<double, py::array::c_style | py::array::forcecast> actions_array;
+                    if ( !actions.is_none() )
+                    {
+                        actions_array = py::array_t<double, py::array::c_style | py::array::forcecast>::ensure( actions );
+                        if ( !actions_array || actions_array.ndim() != 2 ||
+                             actions_array.shape( 0 ) != vec_simulation.num_worlds() ||
+                             actions_array.shape( 1 ) != vec_simulation.action_dim() )
+                            throw std::runtime_error( "VectorizedSimulation::Step >>> actions must be a float array of shape (" +
+                                                      std::to_string( vec_simulation.num_worlds() ) + ", " +
+                                                      std::to_string( vec_simulation.action_dim() ) + ")" );
+                    }
+                    {
+                        py::gil_scoped_release release;
+                        vec_simulation.Step( actions.is_none() ? nullptr : actions_array.data() );
+                    }
+                    return py::make_tuple( ObservationsView( vec_simulation, self ), DonesView( vec_simulation, self ) );
+                }, py::arg( "actions" ) = py::none() )
+            .def( "Reset", []( py::object self )
+                {
+                    auto& vec_simulation = self.cast<TRaisimVectorizedSimulation&>();
+                    {
+                        py::gil_scoped_release release;
+                        vec_simulation.Reset();
+                    }
+                    return ObservationsView( vec_simulation, self );
+                } )
+            .def_property_readonly( "observations", []( py::object self )
+                {
+                    return ObservationsView( self.cast<const TRaisimVectorizedSimulation&>(), self );
+                } )
+            .def_property_readonly( "dones", []( py::object self )
+                {
+                    return DonesView( self.cast<const TRaisimVectorizedSimulation&>(), self );
+                } )
+            .def_property_readonly( "terminal_observations", []( py::object self )
+                {
+                    const auto& vec_simulation = self.cast<const TRaisimVectorizedSimulation&>();
+                    return ObservationsView( vec_simulation, vec_simulation.terminal_observations(), self );
+                } )
+            .def_property_readonly( "episode_steps", []( py::object self )
+                {
+                    const auto& vec_simulation = self.cast<const TRaisimVectorizedSimulation&>();
+                    return py::array_t<int64_t>( { vec_simulation.num_worlds() },
+                                                 { (ssize_t)sizeof( int64_t ) },
+                                                 vec_simulation.episode_steps(), self );
+                } )
+            .def( "AddTerminationCondition", &TRaisimVectorizedSimulation::AddTerminationCondition,
+                  py::arg( "type" ), py::arg( "target_name" ) = "", py::arg( "threshold" ) = 0.0 )
+            .def( "SetAutoReset", &TRaisimVectorizedSimulation::SetAutoReset, py::arg( "auto_reset" ) )
+            .def( "SaveSnapshot", &TRaisimVectorizedSimulation::SaveSnapshot )
+            .def_property_readonly( "num_worlds", &TRaisimVectorizedSimulation::num_worlds )
+            .def_property_readonly( "observation_dim", &TRaisimVectorizedSimulation::observation_dim )
+            .def_property_readonly( "action_dim", &TRaisimVectorizedSimulation::action_dim )
+            .def_property_readonly( "action_mode", &TRaisimVectorizedSimulation::action_mode )
+            .def( "GetMemoryReport", &TRaisimVectorizedSimulation::GetMemoryReport );
+    }
+
+}}
+
+PYBIND11_MODULE( loco_raisim, m )
+{
+    py::module::import( "loco" );
+
+    loco::raisimlib::bindings_profiling( m );
+    loco::raisimlib::bindings_tracing( m );
+    loco::raisimlib::bindings_allocs( m );
+    loco::raisimlib::bindings_memory( m );
+    loco::raisimlib::bindings_kintrees( m );
+    loco::raisimlib::bindings_pool( m );
+    loco::raisimlib::bindings_scene_file( m );
+    loco::raisimlib::bindings_hfield_source( m );
+    loco::raisimlib::bindings_recorder( m );
+    loco::raisimlib::bindings_vectorized( m );
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+
+# --------------------------------------------------------------------------- #
+# script/build_pgo: Builds the backend with profile-guided optimization, by   #
+#                   training an instrumented build on the benchmark suite     #
+# --------------------------------------------------------------------------- #
+
+set -e
+
+SOURCE_DIR=$(pwd)
+BUILD_DIR=${1:-build_pgo}
+PROFILES_DIR=$(realpath -m "${BUILD_DIR}/pgo_profiles")
+NATIVE=${LOCO_RAISIM_BUILD_NATIVE:-OFF}
+
+rm -rf "${PROFILES_DIR}"
+mkdir -p "${BUILD_DIR}"
+
+echo "===> Building instrumented (PGOGenerate) ..."
+# (configured from within the build folder, as cmake -S|-B requires CMake >= 3.13)
+( cd "${BUILD_DIR}" && cmake "${SOURCE_DIR}" -DLOCO_RAISIM_BUILD_PROFILE=PGOGenerate \
+                                             -DLOCO_RAISIM_PGO_PROFILES_DIR="${PROFILES_DIR}" \
+                                             -DLOCO_RAISIM_BUILD_NATIVE=${NATIVE} \
+                                             -DLOCO_RAISIM_BUILD_BENCHMARKS=ON )
+cmake --build "${BUILD_DIR}" -- -j"$(nproc)"
+
+echo "===> Training on the benchmark suite ..."
+"${BUILD_DIR}/bench/bench_step_throughput_raisim" --benchmark_min_time=0.1
+
+echo "===> Building optimized (PGOUse) ..."
+( cd "${BUILD_DIR}" && cmake "${SOURCE_DIR}" -DLOCO_RAISIM_BUILD_PROFILE=PGOUse )
+cmake --build "${BUILD_DIR}" -- -j"$(nproc)"
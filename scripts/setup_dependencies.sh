@@ -1,11 +1,11 @@
 #!/usr/bin/env bash
 
-GIT_DEPS_REPO=(tiny_math pybind11 imgui spdlog tiny_renderer tysoc googletest raisimLib)
-GIT_DEPS_USER=(wpumacay RobotLocomotion wpumacay gabime wpumacay wpumacay google leggedrobotics)
-GIT_DEPS_BRANCH=(master drake docking v1.x master master master master)
-GIT_DEPS_DEST=(ext/tiny_math ext/pybind11 ext/imgui ext/spdlog ext/tiny_renderer core ext/googletest ext/raisim)
+GIT_DEPS_REPO=(tiny_math pybind11 imgui spdlog tiny_renderer tysoc googletest raisimLib benchmark)
+GIT_DEPS_USER=(wpumacay RobotLocomotion wpumacay gabime wpumacay wpumacay google leggedrobotics google)
+GIT_DEPS_BRANCH=(master drake docking v1.x master master master master v1.5.2)
+GIT_DEPS_DEST=(ext/tiny_math ext/pybind11 ext/imgui ext/spdlog ext/tiny_renderer core ext/googletest ext/raisim ext/benchmark)
 
-for i in {0..7}
+for i in {0..8}
 do
     USER=${GIT_DEPS_USER[$i]}
     REPO=${GIT_DEPS_REPO[$i]}
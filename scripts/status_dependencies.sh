@@ -1,6 +1,6 @@
 #!/usr/bin/env bash
 
-for repo in ext/raisim ext/imgui ext/spdlog ext/pybind11 ext/tiny_math ext/tiny_renderer ext/googletest core
+for repo in ext/raisim ext/imgui ext/spdlog ext/pybind11 ext/tiny_math ext/tiny_renderer ext/googletest ext/benchmark core
 do
     if [ -d ${repo} ]
     then
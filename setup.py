@@ -80,14 +80,18 @@ class BuildCommand( build_ext ) :
 
     user_options = [ ( 'windowed=', None, 'Whether to build with OpenGL-GLFW backend support' ),
                      ( 'headless=', None, 'Whether to build with OpenGL-EGL backend support' ),
-                     ( 'debug=', None, 'Whether to build in debug-mode or not' ) ]
-    boolean_options = [ 'windowed', 'headless', 'debug' ]
+                     ( 'debug=', None, 'Whether to build in debug-mode or not' ),
+                     ( 'profile=', None, 'Build profile used for release builds (Throughput|PGOUse)' ),
+                     ( 'native=', None, 'Whether to tune the generated code for the host cpu (-march=native)' ) ]
+    boolean_options = [ 'windowed', 'headless', 'debug', 'native' ]
 
     def initialize_options( self ) :
         super( BuildCommand, self ).initialize_options()
         self.windowed = 1 # Build with windowed-visualizer (openglviz-GLFW) by default
         self.headless = 1 # Build with headless-visualizer (openglviz-EGL) by default
-        self.debug = 1 # Build in debug mode by default
+        self.debug = 0 # Build in release mode by default
+        self.profile = 'Throughput' # Build with the fast profile (O3 + LTO, no logs|allocs-tracking) by default
+        self.native = 0 # Build portable binaries by default
 
     def run( self ) :
         try:
@@ -108,6 +112,8 @@ class BuildCommand( build_ext ) :
         _cfg = 'Debug' if self.debug else 'Release'
         _windowed = 'ON' if self.windowed else 'OFF'
         _headless = 'ON' if self.headless else 'OFF'
+        _profile = 'Default' if self.debug else self.profile
+        _native = 'ON' if self.native else 'OFF'
         _buildArgs = ['--config', _cfg, '--', '-j8']
         _cmakeArgs = ['-DCMAKE_LIBRARY_OUTPUT_DIRECTORY=' + _extensionDirPath,
                       '-DCMAKE_BUILD_RPATH=' + GetInstallationDir(),
@@ -123,7 +129,9 @@ class BuildCommand( build_ext ) :
                       '-DLOCO_CORE_BUILD_TESTS=OFF',
                       '-DLOCO_CORE_BUILD_PYTHON_BINDINGS=ON',
                       '-DLOCO_CORE_BUILD_WITH_LOGS=OFF',
-                      '-DLOCO_CORE_BUILD_WITH_TRACK_ALLOCS=OFF']
+                      '-DLOCO_CORE_BUILD_WITH_TRACK_ALLOCS=OFF',
+                      '-DLOCO_RAISIM_BUILD_PROFILE=' + _profile,
+                      '-DLOCO_RAISIM_BUILD_NATIVE=' + _native]
 
         _env = os.environ.copy()
         _env['CXXFLAGS'] = '{} -DVERSION_INFO=\\"{}\\"'.format( _env.get( 'CXXFLAGS', '' ),
@@ -143,10 +151,13 @@ class InstallCommand( install ) :
         super( InstallCommand, self ).initialize_options()
         self.windowed = 1 # Build with windowed-visualizer (openglviz-GLFW) by default
         self.headless = 1 # Build with headless-visualizer (openglviz-EGL) by default
-        self.debug = 1 # Build in debug mode by default
+        self.debug = 0 # Build in release mode by default
+        self.profile = 'Throughput' # Build with the fast profile (O3 + LTO, no logs|allocs-tracking) by default
+        self.native = 0 # Build portable binaries by default
 
     def run( self ) :
-        self.reinitialize_command( 'build_ext', headless=self.headless, debug=self.debug, windowed=self.windowed )
+        self.reinitialize_command( 'build_ext', headless=self.headless, debug=self.debug, windowed=self.windowed,
+                                   profile=self.profile, native=self.native )
         self.run_command( 'build_ext' )
         super( InstallCommand, self ).run()
 
@@ -0,0 +1,178 @@
+#include <compounds/loco_compound_adapter_raisim.h>
+#include <loco_allocs_raisim.h>
+#include <loco_trace_raisim.h>
+#include <compounds/loco_compound.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimCompoundAdapter::TRaisimCompoundAdapter( TCompound* compound_ref )
+    {
+        LOCO_CORE_ASSERT( compound_ref, "TRaisimCompoundAdapter >>> given compound reference should be \
+                          valid (not nullptr)" );
+
+        m_CompoundRef = compound_ref;
+        m_RaisimWorldRef = nullptr;
+        m_RaisimCompoundRef = nullptr;
+        m_LocalCom = Eigen::Vector3d::Zero();
+
+        LOCO_RAISIM_TRACK_CREATED( COMPOUND_ADAPTER );
+    }
+
+    TRaisimCompoundAdapter::~TRaisimCompoundAdapter()
+    {
+        m_CompoundRef = nullptr;
+        m_RaisimWorldRef = nullptr;
+        m_RaisimCompoundRef = nullptr;
+
+        LOCO_RAISIM_TRACK_DESTROYED( COMPOUND_ADAPTER );
+    }
+
+    void TRaisimCompoundAdapter::Build()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "compound_build", m_RaisimWorldRef );
+        LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimCompoundAdapter::Build >>> raisim world-reference \
+                          required for building a compound (not nullptr)" );
+
+        std::vector<TShapeData> shapes_data;
+        std::vector<TMat4> shapes_local_tfs;
+        for ( auto collider : m_CompoundRef->colliders() )
+        {
+            shapes_data.push_back( collider->data() );
+            shapes_local_tfs.push_back( collider->local_tf0() );
+        }
+
+        TVec3 local_com;
+        m_RaisimCompoundRef = CreateCompound( m_RaisimWorldRef, shapes_data, shapes_local_tfs, m_CompoundRef->inertia(), local_com );
+        m_LocalCom = vec3_to_eigen( local_com );
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::Build >>> something went wrong while \
+                          creating a raisim compound for compound {0}", m_CompoundRef->name() );
+
+        if ( m_CompoundRef->dyntype() == eDynamicsType::DYNAMIC )
+            m_RaisimCompoundRef->setBodyType( raisim::BodyType::DYNAMIC );
+        else
+            m_RaisimCompoundRef->setBodyType( raisim::BodyType::STATIC );
+    }
+
+    void TRaisimCompoundAdapter::Initialize()
+    {
+        _SetupInitialPose();
+        if ( m_CompoundRef->dyntype() == eDynamicsType::DYNAMIC )
+            _SetupInitialVelocity();
+    }
+
+    void TRaisimCompoundAdapter::Reset()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "compound_reset", m_RaisimWorldRef );
+        _SetupInitialPose();
+        if ( m_CompoundRef->dyntype() == eDynamicsType::DYNAMIC )
+            _SetupInitialVelocity();
+    }
+
+    void TRaisimCompoundAdapter::PostStep()
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::PostStep >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        if ( m_CompoundRef->dyntype() != eDynamicsType::DYNAMIC )
+            return;
+
+        TMat4 transform;
+        GetTransform( transform );
+        m_CompoundRef->SetTransform( transform );
+    }
+
+    void TRaisimCompoundAdapter::_SetupInitialPose()
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::_SetupInitialPose >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        _SetRaisimPose( m_CompoundRef->tf0() );
+    }
+
+    void TRaisimCompoundAdapter::_SetupInitialVelocity()
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::_SetupInitialVelocity >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        _SetRaisimVelocity( vec3_to_eigen( m_CompoundRef->linear_vel0() ), vec3_to_eigen( m_CompoundRef->angular_vel0() ) );
+    }
+
+    void TRaisimCompoundAdapter::SetTransform( const TMat4& transform )
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::SetTransform >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        _SetRaisimPose( transform );
+    }
+
+    void TRaisimCompoundAdapter::_SetRaisimPose( const TMat4& transform )
+    {
+        const Eigen::Matrix3d rotation = mat3_to_eigen( TMat3( transform ) );
+        const Eigen::Vector3d position = vec3_to_eigen( TVec3( transform.col( 3 ) ) );
+        m_RaisimCompoundRef->setPose( position + rotation * m_LocalCom, rotation );
+    }
+
+    void TRaisimCompoundAdapter::_SetRaisimVelocity( const Eigen::Vector3d& linear_vel, const Eigen::Vector3d& angular_vel )
+    {
+        // v_com = v_frame + w x ( R * local_com ), using the current orientation of the compound
+        const Eigen::Matrix3d rotation = m_RaisimCompoundRef->getRotationMatrix();
+        m_RaisimCompoundRef->setVelocity( linear_vel + angular_vel.cross( rotation * m_LocalCom ), angular_vel );
+    }
+
+    Eigen::Vector3d TRaisimCompoundAdapter::_GetFrameLinearVelocity() const
+    {
+        // v_frame = v_com - w x ( R * local_com )
+        const Eigen::Matrix3d rotation = m_RaisimCompoundRef->getRotationMatrix();
+        const Eigen::Vector3d angular_velocity = m_RaisimCompoundRef->getAngularVelocity();
+        const Eigen::Vector3d com_linear_velocity = m_RaisimCompoundRef->getLinearVelocity();
+        return com_linear_velocity - angular_velocity.cross( rotation * m_LocalCom );
+    }
+
+    void TRaisimCompoundAdapter::SetLinearVelocity( const TVec3& linear_vel )
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::SetLinearVelocity >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        const Eigen::Vector3d old_angular_velocity = m_RaisimCompoundRef->getAngularVelocity();
+        _SetRaisimVelocity( vec3_to_eigen( linear_vel ), old_angular_velocity );
+    }
+
+    void TRaisimCompoundAdapter::SetAngularVelocity( const TVec3& angular_vel )
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::SetAngularVelocity >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        // Keeps the compound frame moving as before (the com velocity changes if the com is offset)
+        const Eigen::Vector3d old_linear_velocity = _GetFrameLinearVelocity();
+        _SetRaisimVelocity( old_linear_velocity, vec3_to_eigen( angular_vel ) );
+    }
+
+    void TRaisimCompoundAdapter::GetTransform( TMat4& dst_transform ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::GetTransform >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        const Eigen::Matrix3d rotation = m_RaisimCompoundRef->getRotationMatrix();
+        const Eigen::Vector3d position = m_RaisimCompoundRef->getPosition();
+        dst_transform.set( vec3_from_eigen( position - rotation * m_LocalCom ), 3 );
+        dst_transform.set( mat3_from_eigen( rotation ) );
+    }
+
+    void TRaisimCompoundAdapter::GetLinearVelocity( TVec3& dst_linear_vel ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::GetLinearVelocity >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        dst_linear_vel = vec3_from_eigen( _GetFrameLinearVelocity() );
+    }
+
+    void TRaisimCompoundAdapter::GetAngularVelocity( TVec3& dst_angular_vel ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimCompoundRef, "TRaisimCompoundAdapter::GetAngularVelocity >>> must have \
+                          a valid raisim compound reference (not nullptr) for compound {0}", m_CompoundRef->name() );
+
+        dst_angular_vel = vec3_from_eigen( m_RaisimCompoundRef->getAngularVelocity() );
+    }
+
+}}
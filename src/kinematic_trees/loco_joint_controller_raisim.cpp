@@ -0,0 +1,35 @@
+#include <kinematic_trees/loco_joint_controller_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    void TRaisimJointController::Initialize( const std::vector<TRaisimKinematicTreeAdapter*>& kintree_adapters )
+    {
+        m_KintreeAdaptersRefs = kintree_adapters;
+        m_OffsetsGeneralizedCoordinates.clear();
+        m_OffsetsDofs.clear();
+        m_TotalGeneralizedCoordinates = 0;
+        m_TotalDofs = 0;
+        for ( auto kintree_adapter : m_KintreeAdaptersRefs )
+        {
+            m_OffsetsGeneralizedCoordinates.push_back( m_TotalGeneralizedCoordinates );
+            m_OffsetsDofs.push_back( m_TotalDofs );
+            m_TotalGeneralizedCoordinates += kintree_adapter->num_generalized_coordinates();
+            m_TotalDofs += kintree_adapter->num_dofs();
+        }
+    }
+
+    void TRaisimJointController::SetGains( const double* kp, const double* kd )
+    {
+        for ( ssize_t i = 0; i < m_KintreeAdaptersRefs.size(); i++ )
+            m_KintreeAdaptersRefs[i]->SetPdGains( kp + m_OffsetsDofs[i], kd + m_OffsetsDofs[i] );
+    }
+
+    void TRaisimJointController::SetTargets( const double* q_targets, const double* qd_targets )
+    {
+        for ( ssize_t i = 0; i < m_KintreeAdaptersRefs.size(); i++ )
+            m_KintreeAdaptersRefs[i]->SetPdTargets( q_targets + m_OffsetsGeneralizedCoordinates[i],
+                                                    ( qd_targets ) ? qd_targets + m_OffsetsDofs[i] : nullptr );
+    }
+
+}}
@@ -0,0 +1,293 @@
+#include <kinematic_trees/loco_kinematic_tree_adapter_raisim.h>
+#include <loco_allocs_raisim.h>
+#include <loco_trace_raisim.h>
+#include <kinematic_trees/loco_model_source_cache_raisim.h>
+
+#include <limits>
+#include <kinematic_trees/loco_kinematic_tree.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimKinematicTreeAdapter::TRaisimKinematicTreeAdapter( TKinematicTree* kintree_ref )
+    {
+        LOCO_CORE_ASSERT( kintree_ref, "TRaisimKinematicTreeAdapter >>> given kintree reference should \
+                          be valid (not nullptr)" );
+
+        m_KintreeRef = kintree_ref;
+        m_RaisimWorldRef = nullptr;
+        m_RaisimArticulatedSystemRef = nullptr;
+        m_NumGeneralizedCoordinates = 0;
+        m_NumDofs = 0;
+        m_NumLinks = 0;
+        m_HasFloatingBase = false;
+        m_PdControlEnabled = false;
+
+        LOCO_RAISIM_TRACK_CREATED( KINTREE_ADAPTER );
+    }
+
+    TRaisimKinematicTreeAdapter::~TRaisimKinematicTreeAdapter()
+    {
+        m_KintreeRef = nullptr;
+        m_RaisimWorldRef = nullptr;
+        m_RaisimArticulatedSystemRef = nullptr;
+
+        LOCO_RAISIM_TRACK_DESTROYED( KINTREE_ADAPTER );
+    }
+
+    void TRaisimKinematicTreeAdapter::Build()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "kintree_build", m_RaisimWorldRef );
+        LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimKinematicTreeAdapter::Build >>> raisim world-reference \
+                          required for building an articulated-system (not nullptr)" );
+
+        if ( m_ModelFilepath.empty() )
+        {
+            LOCO_CORE_ERROR( "TRaisimKinematicTreeAdapter::Build >>> kintree {0} has no model file (set one through \
+                             TRaisimSimulation::SetKintreeModelFile before initializing)", m_KintreeRef->name() );
+            return;
+        }
+
+        // Model files are read and resolved once and shared across kintrees (raisim still parses one copy per kintree)
+        m_RaisimArticulatedSystemRef = TRaisimModelSourceCache::GetInstance().AddArticulatedSystem( m_RaisimWorldRef, m_ModelFilepath );
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::Build >>> something went \
+                          wrong while creating a raisim articulated-system for kintree {0}", m_KintreeRef->name() );
+
+        m_NumGeneralizedCoordinates = m_RaisimArticulatedSystemRef->getGeneralizedCoordinateDim();
+        m_NumDofs = m_RaisimArticulatedSystemRef->getDOF();
+        m_NumLinks = m_RaisimArticulatedSystemRef->getBodyNames().size();
+        m_HasFloatingBase = ( m_RaisimArticulatedSystemRef->getJointType( 0 ) == raisim::Joint::Type::FLOATING );
+        m_ScratchGeneralizedCoordinates = Eigen::VectorXd::Zero( m_NumGeneralizedCoordinates );
+        m_ScratchGeneralizedVelocities = Eigen::VectorXd::Zero( m_NumDofs );
+        m_ScratchGeneralizedForces = Eigen::VectorXd::Zero( m_NumDofs );
+        m_ScratchJacobian = Eigen::MatrixXd::Zero( 3, m_NumDofs );
+        m_ScratchPdGainsP = Eigen::VectorXd::Zero( m_NumDofs );
+        m_ScratchPdGainsD = Eigen::VectorXd::Zero( m_NumDofs );
+        m_ScratchPdTargetsQ = Eigen::VectorXd::Zero( m_NumGeneralizedCoordinates );
+        m_ScratchPdTargetsQd = Eigen::VectorXd::Zero( m_NumDofs );
+    }
+
+    void TRaisimKinematicTreeAdapter::Initialize()
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::Initialize >>> must have \
+                          a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        // Place the root of the kintree at its initial pose, and keep the resulting state for resets
+        const auto tf0 = m_KintreeRef->tf0();
+        m_RaisimArticulatedSystemRef->setBasePos( vec3_to_raisim( TVec3( tf0.col( 3 ) ) ) );
+        m_RaisimArticulatedSystemRef->setBaseOrientation( mat3_to_raisim( TMat3( tf0 ) ) );
+
+        m_GeneralizedCoordinates0 = m_RaisimArticulatedSystemRef->getGeneralizedCoordinate().e();
+        m_GeneralizedVelocities0 = Eigen::VectorXd::Zero( m_NumDofs );
+        m_RaisimArticulatedSystemRef->setState( m_GeneralizedCoordinates0, m_GeneralizedVelocities0 );
+    }
+
+    void TRaisimKinematicTreeAdapter::Reset()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "kintree_reset", m_RaisimWorldRef );
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::Reset >>> must have \
+                          a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        m_ScratchGeneralizedForces.setZero();
+        m_RaisimArticulatedSystemRef->setState( m_GeneralizedCoordinates0, m_GeneralizedVelocities0 );
+        m_RaisimArticulatedSystemRef->setGeneralizedForce( m_ScratchGeneralizedForces );
+
+        // Hold the initial configuration, so the pd-controller doesn't drive the kintree to stale targets
+        if ( m_PdControlEnabled )
+        {
+            m_ScratchPdTargetsQ = m_GeneralizedCoordinates0;
+            m_ScratchPdTargetsQd.setZero();
+            m_RaisimArticulatedSystemRef->setPdTarget( m_ScratchPdTargetsQ, m_ScratchPdTargetsQd );
+        }
+    }
+
+    void TRaisimKinematicTreeAdapter::PostStep()
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::PostStep >>> must have \
+                          a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        raisim::Mat<3, 3> root_rotation;
+        raisim::Vec<3> root_position;
+        m_RaisimArticulatedSystemRef->getBodyPose( 0, root_rotation, root_position );
+        m_KintreeRef->SetTransform( TMat4( mat3_from_raisim( root_rotation ), vec3_from_raisim( root_position ) ) );
+    }
+
+    void TRaisimKinematicTreeAdapter::GetGeneralizedCoordinates( double* dst_gc ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetGeneralizedCoordinates >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        Eigen::Map<Eigen::VectorXd>( dst_gc, m_NumGeneralizedCoordinates ) = m_RaisimArticulatedSystemRef->getGeneralizedCoordinate().e();
+    }
+
+    void TRaisimKinematicTreeAdapter::GetGeneralizedVelocities( double* dst_gv ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetGeneralizedVelocities >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        Eigen::Map<Eigen::VectorXd>( dst_gv, m_NumDofs ) = m_RaisimArticulatedSystemRef->getGeneralizedVelocity().e();
+    }
+
+    void TRaisimKinematicTreeAdapter::SetGeneralizedCoordinates( const double* gc )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetGeneralizedCoordinates >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        m_ScratchGeneralizedCoordinates = Eigen::Map<const Eigen::VectorXd>( gc, m_NumGeneralizedCoordinates );
+        m_RaisimArticulatedSystemRef->setGeneralizedCoordinate( m_ScratchGeneralizedCoordinates );
+    }
+
+    void TRaisimKinematicTreeAdapter::SetGeneralizedVelocities( const double* gv )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetGeneralizedVelocities >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        m_ScratchGeneralizedVelocities = Eigen::Map<const Eigen::VectorXd>( gv, m_NumDofs );
+        m_RaisimArticulatedSystemRef->setGeneralizedVelocity( m_ScratchGeneralizedVelocities );
+    }
+
+    void TRaisimKinematicTreeAdapter::SetState( const double* gc, const double* gv )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetState >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        m_ScratchGeneralizedCoordinates = Eigen::Map<const Eigen::VectorXd>( gc, m_NumGeneralizedCoordinates );
+        m_ScratchGeneralizedVelocities = Eigen::Map<const Eigen::VectorXd>( gv, m_NumDofs );
+        m_RaisimArticulatedSystemRef->setState( m_ScratchGeneralizedCoordinates, m_ScratchGeneralizedVelocities );
+    }
+
+    void TRaisimKinematicTreeAdapter::SetGeneralizedForces( const double* tau )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetGeneralizedForces >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        m_ScratchGeneralizedForces = Eigen::Map<const Eigen::VectorXd>( tau, m_NumDofs );
+        m_RaisimArticulatedSystemRef->setGeneralizedForce( m_ScratchGeneralizedForces );
+    }
+
+    void TRaisimKinematicTreeAdapter::GetLinkFrames( double* dst_frames, double* dst_velocities ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetLinkFrames >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        raisim::Mat<3, 3> link_rotation;
+        raisim::Vec<3> link_position;
+        raisim::Vec<4> link_quaternion;
+        for ( ssize_t i = 0; i < m_NumLinks; i++ )
+        {
+            m_RaisimArticulatedSystemRef->getBodyPose( i, link_rotation, link_position );
+            raisim::rotMatToQuat( link_rotation, link_quaternion );
+            double* dst_frame = dst_frames + 7 * i;
+            dst_frame[0] = link_position[0]; dst_frame[1] = link_position[1]; dst_frame[2] = link_position[2];
+            dst_frame[3] = link_quaternion[0]; dst_frame[4] = link_quaternion[1];
+            dst_frame[5] = link_quaternion[2]; dst_frame[6] = link_quaternion[3];
+        }
+
+        if ( !dst_velocities )
+            return;
+
+        const raisim::Vec<3> link_origin = { 0.0, 0.0, 0.0 };
+        raisim::Vec<3> link_linear_vel, link_angular_vel;
+        for ( ssize_t i = 0; i < m_NumLinks; i++ )
+        {
+            m_RaisimArticulatedSystemRef->getVelocity( i, link_origin, link_linear_vel );
+            m_RaisimArticulatedSystemRef->getAngularVelocity( i, link_angular_vel );
+            double* dst_velocity = dst_velocities + 6 * i;
+            dst_velocity[0] = link_linear_vel[0]; dst_velocity[1] = link_linear_vel[1]; dst_velocity[2] = link_linear_vel[2];
+            dst_velocity[3] = link_angular_vel[0]; dst_velocity[4] = link_angular_vel[1]; dst_velocity[5] = link_angular_vel[2];
+        }
+    }
+
+    ssize_t TRaisimKinematicTreeAdapter::GetFrameIndex( const std::string& frame_name ) const
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetFrameIndex >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        const size_t frame_index = m_RaisimArticulatedSystemRef->getFrameIdxByName( frame_name );
+        if ( frame_index == std::numeric_limits<size_t>::max() )
+            return -1;
+        return frame_index;
+    }
+
+    void TRaisimKinematicTreeAdapter::GetMassMatrix( double* dst_mass_matrix )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetMassMatrix >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        // Mass-matrix is symmetric, so column-major storage from raisim equals the row-major layout
+        Eigen::Map<Eigen::MatrixXd>( dst_mass_matrix, m_NumDofs, m_NumDofs ) = m_RaisimArticulatedSystemRef->getMassMatrix().e();
+    }
+
+    void TRaisimKinematicTreeAdapter::GetNonlinearEffects( double* dst_nonlinear_effects )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetNonlinearEffects >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        Eigen::Map<Eigen::VectorXd>( dst_nonlinear_effects, m_NumDofs ) = m_RaisimArticulatedSystemRef->getNonlinearities().e();
+    }
+
+    void TRaisimKinematicTreeAdapter::GetFrameJacobian( ssize_t frame_index, double* dst_jacobian )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::GetFrameJacobian >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        raisim::Vec<3> frame_position;
+        m_RaisimArticulatedSystemRef->getFramePosition( frame_index, frame_position );
+        const size_t parent_body_index = m_RaisimArticulatedSystemRef->getFrameByIdx( frame_index ).parentId;
+
+        m_ScratchJacobian.setZero();
+        m_RaisimArticulatedSystemRef->getDenseJacobian( parent_body_index, frame_position, m_ScratchJacobian );
+        Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>( dst_jacobian, 3, m_NumDofs ) = m_ScratchJacobian;
+    }
+
+    void TRaisimKinematicTreeAdapter::SetPdGains( const double* kp, const double* kd )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetPdGains >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        if ( !m_PdControlEnabled )
+        {
+            // Start by holding the current configuration, until the user gives some targets
+            m_ScratchPdTargetsQ = m_RaisimArticulatedSystemRef->getGeneralizedCoordinate().e();
+            m_ScratchPdTargetsQd.setZero();
+            m_RaisimArticulatedSystemRef->setPdTarget( m_ScratchPdTargetsQ, m_ScratchPdTargetsQd );
+            m_RaisimArticulatedSystemRef->setControlMode( raisim::ControlMode::PD_PLUS_FEEDFORWARD_TORQUE );
+            m_PdControlEnabled = true;
+        }
+
+        m_ScratchPdGainsP = Eigen::Map<const Eigen::VectorXd>( kp, m_NumDofs );
+        m_ScratchPdGainsD = Eigen::Map<const Eigen::VectorXd>( kd, m_NumDofs );
+        m_RaisimArticulatedSystemRef->setPdGains( m_ScratchPdGainsP, m_ScratchPdGainsD );
+    }
+
+    void TRaisimKinematicTreeAdapter::SetPdTargets( const double* q_target, const double* qd_target )
+    {
+        LOCO_CORE_ASSERT( m_RaisimArticulatedSystemRef, "TRaisimKinematicTreeAdapter::SetPdTargets >>> \
+                          must have a valid raisim articulated-system reference (not nullptr) for kintree {0}", m_KintreeRef->name() );
+
+        if ( !m_PdControlEnabled )
+        {
+            LOCO_CORE_WARN( "TRaisimKinematicTreeAdapter::SetPdTargets >>> pd-gains must be set before giving \
+                             pd-targets to kintree {0}", m_KintreeRef->name() );
+            return;
+        }
+
+        m_ScratchPdTargetsQ = Eigen::Map<const Eigen::VectorXd>( q_target, m_NumGeneralizedCoordinates );
+        if ( qd_target )
+            m_ScratchPdTargetsQd = Eigen::Map<const Eigen::VectorXd>( qd_target, m_NumDofs );
+        else
+            m_ScratchPdTargetsQd.setZero();
+        m_RaisimArticulatedSystemRef->setPdTarget( m_ScratchPdTargetsQ, m_ScratchPdTargetsQd );
+    }
+
+    size_t TRaisimKinematicTreeAdapter::memory_bytes() const
+    {
+        const ssize_t num_scratch_entries = m_GeneralizedCoordinates0.size() + m_GeneralizedVelocities0.size() +
+                                            m_ScratchGeneralizedCoordinates.size() + m_ScratchGeneralizedVelocities.size() +
+                                            m_ScratchGeneralizedForces.size() + m_ScratchJacobian.size() +
+                                            m_ScratchPdGainsP.size() + m_ScratchPdGainsD.size() +
+                                            m_ScratchPdTargetsQ.size() + m_ScratchPdTargetsQd.size();
+        return sizeof( TRaisimKinematicTreeAdapter ) + num_scratch_entries * sizeof( double );
+    }
+
+}}
@@ -0,0 +1,98 @@
+#include <kinematic_trees/loco_kintree_dynamics_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    void SpreadRowsInPlace( double* data, ssize_t rows, ssize_t cols, ssize_t stride )
+    {
+        if ( cols == stride )
+            return;
+
+        // Go from the last row backwards, so rows are moved before anything overwrites them
+        for ( ssize_t row = rows - 1; row >= 0; row-- )
+        {
+            if ( row > 0 )
+                std::copy_backward( data + row * cols, data + ( row + 1 ) * cols, data + row * stride + cols );
+            std::fill( data + row * stride + cols, data + ( row + 1 ) * stride, 0.0 );
+        }
+    }
+
+    TRaisimKintreesDynamicsQuery::TRaisimKintreesDynamicsQuery( const std::vector<TRaisimKinematicTreeAdapter*>& kintree_adapters,
+                                                                const std::vector<std::string>& frame_names )
+    {
+        m_KintreeAdaptersRefs = kintree_adapters;
+        m_NumFrames = frame_names.size();
+        m_MaxNumDofs = 0;
+        for ( auto kintree_adapter : m_KintreeAdaptersRefs )
+        {
+            m_MaxNumDofs = std::max( m_MaxNumDofs, kintree_adapter->num_dofs() );
+            for ( const auto& frame_name : frame_names )
+            {
+                const ssize_t frame_index = kintree_adapter->GetFrameIndex( frame_name );
+                if ( frame_index < 0 )
+                    LOCO_CORE_ERROR( "TRaisimKintreesDynamicsQuery >>> couldn't find frame {0}, its jacobians will be zero", frame_name );
+                m_FramesIndices.push_back( frame_index );
+            }
+        }
+    }
+
+    void TRaisimKintreesDynamicsQuery::Compute( double* dst_mass_matrices,
+                                                double* dst_nonlinear_effects,
+                                                double* dst_frame_jacobians,
+                                                TRaisimThreadPool* thread_pool )
+    {
+        if ( !thread_pool )
+        {
+            for ( ssize_t i = 0; i < m_KintreeAdaptersRefs.size(); i++ )
+                _ComputeSingle( i, dst_mass_matrices, dst_nonlinear_effects, dst_frame_jacobians );
+            return;
+        }
+
+        thread_pool->ParallelFor( m_KintreeAdaptersRefs.size(), [&]( ssize_t i )
+            {
+                _ComputeSingle( i, dst_mass_matrices, dst_nonlinear_effects, dst_frame_jacobians );
+            } );
+    }
+
+    void TRaisimKintreesDynamicsQuery::_ComputeSingle( ssize_t index,
+                                                       double* dst_mass_matrices,
+                                                       double* dst_nonlinear_effects,
+                                                       double* dst_frame_jacobians )
+    {
+        auto kintree_adapter = m_KintreeAdaptersRefs[index];
+        const ssize_t num_dofs = kintree_adapter->num_dofs();
+        const ssize_t stride = m_MaxNumDofs;
+
+        // Adapters write packed (num_dofs-sized) blocks, which are then spread into the padded layout
+        if ( dst_mass_matrices )
+        {
+            double* dst_mass_matrix = dst_mass_matrices + index * stride * stride;
+            std::fill( dst_mass_matrix, dst_mass_matrix + stride * stride, 0.0 );
+            kintree_adapter->GetMassMatrix( dst_mass_matrix );
+            SpreadRowsInPlace( dst_mass_matrix, num_dofs, num_dofs, stride );
+        }
+
+        if ( dst_nonlinear_effects )
+        {
+            double* dst_nonlinear = dst_nonlinear_effects + index * stride;
+            std::fill( dst_nonlinear, dst_nonlinear + stride, 0.0 );
+            kintree_adapter->GetNonlinearEffects( dst_nonlinear );
+        }
+
+        if ( dst_frame_jacobians )
+        {
+            for ( ssize_t f = 0; f < m_NumFrames; f++ )
+            {
+                double* dst_jacobian = dst_frame_jacobians + ( index * m_NumFrames + f ) * 3 * stride;
+                std::fill( dst_jacobian, dst_jacobian + 3 * stride, 0.0 );
+                const ssize_t frame_index = m_FramesIndices[index * m_NumFrames + f];
+                if ( frame_index < 0 )
+                    continue;
+
+                kintree_adapter->GetFrameJacobian( frame_index, dst_jacobian );
+                SpreadRowsInPlace( dst_jacobian, 3, num_dofs, stride );
+            }
+        }
+    }
+
+}}
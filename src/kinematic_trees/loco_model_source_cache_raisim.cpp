@@ -0,0 +1,113 @@
+#include <kinematic_trees/loco_model_source_cache_raisim.h>
+
+#include <tinyxml2.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Resolves a mesh-reference (relative, absolute, or package://) into an absolute path
+    static std::string ResolveMeshFilepath( const std::string& mesh_filename, const std::string& model_folderpath )
+    {
+        const std::string package_prefix = "package://";
+        if ( mesh_filename.compare( 0, package_prefix.size(), package_prefix ) == 0 )
+        {
+            // Packages are assumed to be siblings of the folder containing the model
+            const std::string parent_folderpath = model_folderpath.substr( 0, model_folderpath.find_last_of( "/\\", model_folderpath.size() - 2 ) + 1 );
+            return parent_folderpath + mesh_filename.substr( package_prefix.size() );
+        }
+        if ( mesh_filename.size() > 0 && mesh_filename[0] == '/' )
+            return mesh_filename;
+        return model_folderpath + mesh_filename;
+    }
+
+    // Recursively resolves the mesh-references (<mesh filename="...">) of all elements under the given element
+    static void ResolveMeshReferences( tinyxml2::XMLElement* element, const std::string& model_folderpath )
+    {
+        for ( auto child = element->FirstChildElement(); child != nullptr; child = child->NextSiblingElement() )
+        {
+            if ( std::string( child->Name() ) == "mesh" && child->Attribute( "filename" ) )
+                child->SetAttribute( "filename", ResolveMeshFilepath( child->Attribute( "filename" ), model_folderpath ).c_str() );
+            ResolveMeshReferences( child, model_folderpath );
+        }
+    }
+
+    TRaisimModelSourceCache& TRaisimModelSourceCache::GetInstance()
+    {
+        static TRaisimModelSourceCache s_Instance;
+        return s_Instance;
+    }
+
+    std::shared_ptr<const TRaisimModelSource> TRaisimModelSourceCache::GetSource( const std::string& model_filepath )
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        auto it_source = m_Sources.find( model_filepath );
+        if ( it_source != m_Sources.end() )
+            return it_source->second;
+
+        auto model_source = _CreateSource( model_filepath );
+        if ( model_source )
+            m_Sources[model_filepath] = model_source;
+        return model_source;
+    }
+
+    raisim::ArticulatedSystem* TRaisimModelSourceCache::AddArticulatedSystem( raisim::World* raisim_world, const std::string& model_filepath )
+    {
+        auto model_source = GetSource( model_filepath );
+        if ( !model_source )
+            return nullptr;
+
+        // Urdf models are created from the in-memory description (no file-io nor path resolution per instance, but
+        // raisim still parses it and loads its meshes)
+        return model_source->is_urdf ?
+                    raisim_world->addArticulatedSystem( model_source->model_str, model_source->resources_path ) :
+                    raisim_world->addArticulatedSystem( model_source->filepath, model_source->resources_path );
+    }
+
+    void TRaisimModelSourceCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        m_Sources.clear();
+    }
+
+    ssize_t TRaisimModelSourceCache::num_sources() const
+    {
+        std::lock_guard<std::mutex> lock( m_Mutex );
+        return m_Sources.size();
+    }
+
+    std::shared_ptr<TRaisimModelSource> TRaisimModelSourceCache::_CreateSource( const std::string& model_filepath )
+    {
+        const std::string extension = model_filepath.substr( model_filepath.find_last_of( '.' ) + 1 );
+        const std::string folderpath = model_filepath.substr( 0, model_filepath.find_last_of( "/\\" ) + 1 );
+
+        auto model_source = std::make_shared<TRaisimModelSource>();
+        model_source->filepath = model_filepath;
+        model_source->resources_path = folderpath;
+        model_source->is_urdf = ( extension == "urdf" );
+
+        if ( model_source->is_urdf )
+        {
+            tinyxml2::XMLDocument model_doc;
+            if ( model_doc.LoadFile( model_filepath.c_str() ) != tinyxml2::XML_SUCCESS )
+            {
+                LOCO_CORE_ERROR( "TRaisimModelSourceCache::_CreateSource >>> couldn't parse model file {0}: {1}",
+                                 model_filepath, model_doc.ErrorStr() );
+                return nullptr;
+            }
+
+            ResolveMeshReferences( model_doc.RootElement(), folderpath );
+            tinyxml2::XMLPrinter model_printer;
+            model_doc.Print( &model_printer );
+            model_source->model_str = model_printer.CStr();
+        }
+        else if ( extension != "xml" )
+        {
+            LOCO_CORE_ERROR( "TRaisimModelSourceCache::_CreateSource >>> unsupported model format {0} (only urdf \
+                              and mjcf models are supported)", model_filepath );
+            return nullptr;
+        }
+
+        return model_source;
+    }
+
+}}
@@ -0,0 +1,103 @@
+#include <loco_allocs_raisim.h>
+
+#include <execinfo.h>
+#include <sstream>
+
+namespace loco {
+namespace raisimlib {
+
+    std::array<std::atomic<int64_t>, TRaisimAllocTracker::NUM_TYPES> TRaisimAllocTracker::s_Created {};
+    std::array<std::atomic<int64_t>, TRaisimAllocTracker::NUM_TYPES> TRaisimAllocTracker::s_Destroyed {};
+    std::atomic<int64_t> TRaisimAllocTracker::s_SampleEvery( 0 );
+    std::vector<TRaisimAllocTracker::TRawSample> TRaisimAllocTracker::s_Samples;
+    ssize_t TRaisimAllocTracker::s_SamplesHead = 0;
+    std::mutex TRaisimAllocTracker::s_SamplesMutex;
+
+    std::string AllocTypeToString( const eRaisimAllocType& type )
+    {
+        switch ( type )
+        {
+            case eRaisimAllocType::SIMULATION : return "simulation";
+            case eRaisimAllocType::SINGLE_BODY_ADAPTER : return "single_body_adapter";
+            case eRaisimAllocType::SINGLE_BODY_COLLIDER_ADAPTER : return "single_body_collider_adapter";
+            case eRaisimAllocType::COMPOUND_ADAPTER : return "compound_adapter";
+            case eRaisimAllocType::KINTREE_ADAPTER : return "kintree_adapter";
+            default : return "undefined";
+        }
+    }
+
+    TRaisimAllocCounts TRaisimAllocTracker::counts( const eRaisimAllocType& type )
+    {
+        auto counts = TRaisimAllocCounts();
+        counts.total_created = s_Created[(ssize_t)type].load( std::memory_order_relaxed );
+        counts.total_destroyed = s_Destroyed[(ssize_t)type].load( std::memory_order_relaxed );
+        counts.live = counts.total_created - counts.total_destroyed;
+        return counts;
+    }
+
+    void TRaisimAllocTracker::SetBacktraceSampling( int64_t sample_every )
+    {
+        s_SampleEvery.store( std::max( sample_every, (int64_t)0 ), std::memory_order_relaxed );
+    }
+
+    void TRaisimAllocTracker::_RecordSample( const eRaisimAllocType& type, bool created, const void* address )
+    {
+        TRawSample raw_sample;
+        raw_sample.type = type;
+        raw_sample.created = created;
+        raw_sample.address = address;
+        raw_sample.num_frames = backtrace( raw_sample.frames.data(), MAX_NUM_FRAMES );
+
+        std::lock_guard<std::mutex> lock( s_SamplesMutex );
+        if ( s_Samples.size() < MAX_NUM_SAMPLES )
+            s_Samples.push_back( raw_sample );
+        else
+            s_Samples[s_SamplesHead % MAX_NUM_SAMPLES] = raw_sample;
+        s_SamplesHead++;
+    }
+
+    std::vector<TRaisimAllocSample> TRaisimAllocTracker::samples()
+    {
+        std::lock_guard<std::mutex> lock( s_SamplesMutex );
+        std::vector<TRaisimAllocSample> samples;
+        // Oldest sample first (the ring only wraps once it's full)
+        const ssize_t num_samples = s_Samples.size();
+        const ssize_t first = ( num_samples < MAX_NUM_SAMPLES ) ? 0 : s_SamplesHead % MAX_NUM_SAMPLES;
+        for ( ssize_t i = 0; i < num_samples; i++ )
+        {
+            const auto& raw_sample = s_Samples[( first + i ) % num_samples];
+            auto sample = TRaisimAllocSample();
+            sample.type = raw_sample.type;
+            sample.created = raw_sample.created;
+            sample.address = raw_sample.address;
+            // Skip the frame of _RecordSample itself
+            char** symbols = backtrace_symbols( raw_sample.frames.data(), raw_sample.num_frames );
+            for ( ssize_t j = 1; j < raw_sample.num_frames; j++ )
+                sample.backtrace.push_back( symbols ? symbols[j] : "??" );
+            free( symbols );
+            samples.push_back( std::move( sample ) );
+        }
+        return samples;
+    }
+
+    void TRaisimAllocTracker::ClearSamples()
+    {
+        std::lock_guard<std::mutex> lock( s_SamplesMutex );
+        s_Samples.clear();
+        s_SamplesHead = 0;
+    }
+
+    std::string TRaisimAllocTracker::Report()
+    {
+        std::stringstream report;
+        report << "Loco::Allocs (raisim-backend)\n";
+        for ( ssize_t i = 0; i < NUM_TYPES; i++ )
+        {
+            const auto type_counts = counts( (eRaisimAllocType)i );
+            report << "    " << AllocTypeToString( (eRaisimAllocType)i ) << " : live=" << type_counts.live
+                   << ", created=" << type_counts.total_created << ", destroyed=" << type_counts.total_destroyed << "\n";
+        }
+        return report.str();
+    }
+
+}}
@@ -0,0 +1,65 @@
+#include <loco_arena_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Size of the blocks added once the reserved memory runs out
+    constexpr size_t ARENA_DEFAULT_BLOCK_BYTES = 16 * 1024;
+
+    TRaisimArena::TRaisimArena()
+    {
+        m_Cursor = nullptr;
+        m_End = nullptr;
+        m_Capacity = 0;
+        m_Used = 0;
+    }
+
+    TRaisimArena::~TRaisimArena()
+    {
+        Release();
+    }
+
+    void TRaisimArena::Reserve( size_t num_bytes )
+    {
+        if ( num_bytes > (size_t)( m_End - m_Cursor ) )
+            _AddBlock( num_bytes );
+    }
+
+    void* TRaisimArena::Allocate( size_t num_bytes, size_t alignment )
+    {
+        LOCO_CORE_ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0, "TRaisimArena::Allocate >>> \
+                          alignment must be a power of two, but got {0}", alignment );
+
+        auto aligned = reinterpret_cast<uint8_t*>( ( reinterpret_cast<uintptr_t>( m_Cursor ) + alignment - 1 ) & ~( alignment - 1 ) );
+        if ( !m_Cursor || aligned + num_bytes > m_End )
+        {
+            _AddBlock( std::max( num_bytes + alignment, ARENA_DEFAULT_BLOCK_BYTES ) );
+            aligned = reinterpret_cast<uint8_t*>( ( reinterpret_cast<uintptr_t>( m_Cursor ) + alignment - 1 ) & ~( alignment - 1 ) );
+        }
+
+        m_Used += ( aligned + num_bytes ) - m_Cursor;
+        m_Cursor = aligned + num_bytes;
+        return aligned;
+    }
+
+    void TRaisimArena::Release()
+    {
+        for ( auto block : m_Blocks )
+            ::operator delete( block );
+        m_Blocks.clear();
+        m_Cursor = nullptr;
+        m_End = nullptr;
+        m_Capacity = 0;
+        m_Used = 0;
+    }
+
+    void TRaisimArena::_AddBlock( size_t num_bytes )
+    {
+        auto block = ::operator new( num_bytes );
+        m_Blocks.push_back( block );
+        m_Cursor = static_cast<uint8_t*>( block );
+        m_End = m_Cursor + num_bytes;
+        m_Capacity += num_bytes;
+    }
+
+}}
@@ -1,6 +1,14 @@
 
 #include <loco_common_raisim.h>
 
+#include <limits>
+#if ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #include <immintrin.h>
+    #define LOCO_RAISIM_HAS_AVX2_KERNEL 1
+#else
+    #define LOCO_RAISIM_HAS_AVX2_KERNEL 0
+#endif
+
 namespace loco {
 namespace raisimlib {
 
@@ -243,6 +251,266 @@ namespace raisimlib {
         return raisim_world->addHeightMap( nx_samples, ny_samples, scale_x, scale_y, center_x, center_y, heights );
     }
 
+    raisim::Compound* CreateCompound( raisim::World* raisim_world,
+                                      const std::vector<TShapeData>& shapes_data,
+                                      const std::vector<TMat4>& shapes_local_tfs,
+                                      const TInertialData& inertia_data,
+                                      TVec3& dst_local_com )
+    {
+        std::vector<raisim::Compound::CompoundObjectChild> children;
+        std::vector<double> children_masses;
+        double total_mass = 0.0;
+        Eigen::Vector3d total_moment = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d total_inertia = Eigen::Matrix3d::Zero();
+        for ( ssize_t i = 0; i < shapes_data.size(); i++ )
+        {
+            const auto& shape_data = shapes_data[i];
+            raisim::Compound::CompoundObjectChild child;
+            child.objectParam.setZero();
+            switch ( shape_data.type )
+            {
+                case eShapeType::BOX :
+                {
+                    child.objectType = raisim::ObjectType::BOX;
+                    child.objectParam[0] = shape_data.size.x();
+                    child.objectParam[1] = shape_data.size.y();
+                    child.objectParam[2] = shape_data.size.z();
+                    break;
+                }
+                case eShapeType::SPHERE :
+                {
+                    child.objectType = raisim::ObjectType::SPHERE;
+                    child.objectParam[0] = shape_data.size.x();
+                    break;
+                }
+                case eShapeType::CYLINDER :
+                {
+                    child.objectType = raisim::ObjectType::CYLINDER;
+                    child.objectParam[0] = shape_data.size.x();
+                    child.objectParam[1] = shape_data.size.y();
+                    break;
+                }
+                case eShapeType::CAPSULE :
+                {
+                    child.objectType = raisim::ObjectType::CAPSULE;
+                    child.objectParam[0] = shape_data.size.x();
+                    child.objectParam[1] = shape_data.size.y();
+                    break;
+                }
+                default :
+                {
+                    LOCO_CORE_ERROR( "CreateCompound >>> only primitive shapes (box, sphere, cylinder, capsule) \
+                                      can be part of a compound, skipping shape {0}", i );
+                    continue;
+                }
+            }
+            child.trans.rot = mat3_to_raisim( TMat3( shapes_local_tfs[i] ) );
+            child.trans.pos = vec3_to_raisim( TVec3( shapes_local_tfs[i].col( 3 ) ) );
+            children.push_back( child );
+
+            // Accumulate the children's own (rotated) inertias, the parallel-axis terms need the com first
+            const double child_mass = loco::DEFAULT_DENSITY * loco::ComputeVolumeFromShape( shape_data );
+            const Eigen::Matrix3d child_rot = child.trans.rot.e();
+            children_masses.push_back( child_mass );
+            total_mass += child_mass;
+            total_moment += child_mass * child.trans.pos.e();
+            total_inertia += child_rot * ComputePrimitiveInertia( child_mass, shape_data ).e() * child_rot.transpose();
+        }
+
+        if ( children.size() < 1 )
+        {
+            LOCO_CORE_ERROR( "CreateCompound >>> compound requires at least one primitive shape" );
+            return nullptr;
+        }
+
+        // Raisim places the compound's frame at its com, so children are re-expressed w.r.t. the com
+        const Eigen::Vector3d local_com = total_moment / total_mass;
+        for ( ssize_t i = 0; i < children.size(); i++ )
+        {
+            const Eigen::Vector3d child_pos = children[i].trans.pos.e() - local_com;
+            children[i].trans.pos[0] = child_pos.x(); children[i].trans.pos[1] = child_pos.y(); children[i].trans.pos[2] = child_pos.z();
+            total_inertia += children_masses[i] * ( child_pos.squaredNorm() * Eigen::Matrix3d::Identity() - child_pos * child_pos.transpose() );
+        }
+        dst_local_com = vec3_from_eigen( local_com );
+
+        // User-given mass rescales the shape-based inertia (uniform density), and user-given inertia overrides it
+        raisim::Mat<3, 3> inertia;
+        if ( inertia_data.mass > loco::EPS )
+        {
+            total_inertia *= inertia_data.mass / total_mass;
+            total_mass = inertia_data.mass;
+        }
+        if ( ( inertia_data.ixx > loco::EPS ) && ( inertia_data.iyy > loco::EPS ) && ( inertia_data.izz > loco::EPS ) )
+        {
+            inertia(0, 0) = inertia_data.ixx; inertia(0, 1) = inertia_data.ixy; inertia(0, 2) = inertia_data.ixz;
+            inertia(1, 0) = inertia_data.ixy; inertia(1, 1) = inertia_data.iyy; inertia(1, 2) = inertia_data.iyz;
+            inertia(2, 0) = inertia_data.ixz; inertia(2, 1) = inertia_data.iyz; inertia(2, 2) = inertia_data.izz;
+        }
+        else
+        {
+            inertia.e() = total_inertia;
+        }
+
+        return raisim_world->addCompound( children, total_mass, inertia );
+    }
+
+    raisim::Mat<3, 3> ComputePrimitiveInertia( double mass, const TShapeData& shape_data )
+    {
+        raisim::Mat<3, 3> inertia;
+        inertia.setZero();
+        switch ( shape_data.type )
+        {
+            case eShapeType::BOX :
+            {
+                const double lx = shape_data.size.x(), ly = shape_data.size.y(), lz = shape_data.size.z();
+                inertia(0, 0) = ( mass / 12.0 ) * ( ly * ly + lz * lz );
+                inertia(1, 1) = ( mass / 12.0 ) * ( lx * lx + lz * lz );
+                inertia(2, 2) = ( mass / 12.0 ) * ( lx * lx + ly * ly );
+                break;
+            }
+            case eShapeType::SPHERE :
+            {
+                const double radius = shape_data.size.x();
+                inertia(0, 0) = inertia(1, 1) = inertia(2, 2) = 0.4 * mass * radius * radius;
+                break;
+            }
+            case eShapeType::CYLINDER :
+            case eShapeType::CAPSULE :
+            {
+                // Capsules are approximated by a cylinder spanning the full length (including the caps)
+                const double radius = shape_data.size.x();
+                const double length = shape_data.size.y() + ( ( shape_data.type == eShapeType::CAPSULE ) ? 2.0 * radius : 0.0 );
+                inertia(0, 0) = inertia(1, 1) = ( mass / 12.0 ) * ( 3.0 * radius * radius + length * length );
+                inertia(2, 2) = 0.5 * mass * radius * radius;
+                break;
+            }
+            default :
+            {
+                inertia.setIdentity();
+                break;
+            }
+        }
+        return inertia;
+    }
+
+    THeightMapGridView GetHeightMapGridView( raisim::HeightMap* raisim_hmap )
+    {
+        THeightMapGridView grid;
+        grid.heights = raisim_hmap->getHeightMap().data();
+        grid.nx_samples = raisim_hmap->getXSamples();
+        grid.ny_samples = raisim_hmap->getYSamples();
+        grid.size_x = raisim_hmap->getXSize();
+        grid.size_y = raisim_hmap->getYSize();
+        grid.center_x = raisim_hmap->getCenterX();
+        grid.center_y = raisim_hmap->getCenterY();
+        return grid;
+    }
+
+#if LOCO_RAISIM_HAS_AVX2_KERNEL
+    // Gather-based kernel (4 samples per iteration), compiled for avx2 regardless of the flags of the build,
+    // and only called if the cpu supports it (no fma, so products are rounded exactly as in the scalar kernel).
+    // Returns the number of points it processed (multiple of 4)
+    __attribute__(( target( "avx2" ) ))
+    static ssize_t _SampleHeightsBilinearAvx2( const THeightMapGridView& grid, const double* points_xyz, ssize_t num_points,
+                                              double* dst_heights, double origin_x, double origin_y, double inv_dx, double inv_dy )
+    {
+        const ssize_t nx = grid.nx_samples;
+        const double max_u = grid.nx_samples - 1;
+        const double max_v = grid.ny_samples - 1;
+        const double max_j0 = grid.nx_samples - 2;
+        const double max_i0 = grid.ny_samples - 2;
+
+        ssize_t p = 0;
+        const __m256d v_zero = _mm256_setzero_pd();
+        const __m256d v_origin_x = _mm256_set1_pd( origin_x );
+        const __m256d v_origin_y = _mm256_set1_pd( origin_y );
+        const __m256d v_inv_dx = _mm256_set1_pd( inv_dx );
+        const __m256d v_inv_dy = _mm256_set1_pd( inv_dy );
+        const __m256d v_max_u = _mm256_set1_pd( max_u );
+        const __m256d v_max_v = _mm256_set1_pd( max_v );
+        const __m256d v_max_j0 = _mm256_set1_pd( max_j0 );
+        const __m256d v_max_i0 = _mm256_set1_pd( max_i0 );
+        const __m256d v_nx = _mm256_set1_pd( (double)nx );
+        const __m128i v_one_i = _mm_set1_epi32( 1 );
+        const __m128i v_nx_i = _mm_set1_epi32( (int32_t)nx );
+        for ( ; p + 4 <= num_points; p += 4 )
+        {
+            const double* pts = points_xyz + 3 * p;
+            const __m256d px = _mm256_set_pd( pts[9], pts[6], pts[3], pts[0] );
+            const __m256d py = _mm256_set_pd( pts[10], pts[7], pts[4], pts[1] );
+
+            const __m256d u = _mm256_min_pd( _mm256_max_pd( _mm256_mul_pd( _mm256_sub_pd( px, v_origin_x ), v_inv_dx ), v_zero ), v_max_u );
+            const __m256d v = _mm256_min_pd( _mm256_max_pd( _mm256_mul_pd( _mm256_sub_pd( py, v_origin_y ), v_inv_dy ), v_zero ), v_max_v );
+            const __m256d j0 = _mm256_min_pd( _mm256_floor_pd( u ), v_max_j0 );
+            const __m256d i0 = _mm256_min_pd( _mm256_floor_pd( v ), v_max_i0 );
+            const __m256d tx = _mm256_sub_pd( u, j0 );
+            const __m256d ty = _mm256_sub_pd( v, i0 );
+
+            // Integer-valued doubles, so the conversion to int32 is exact
+            const __m128i idx00 = _mm256_cvtpd_epi32( _mm256_add_pd( _mm256_mul_pd( i0, v_nx ), j0 ) );
+            const __m128i idx01 = _mm_add_epi32( idx00, v_one_i );
+            const __m128i idx10 = _mm_add_epi32( idx00, v_nx_i );
+            const __m128i idx11 = _mm_add_epi32( idx10, v_one_i );
+            const __m256d h00 = _mm256_i32gather_pd( grid.heights, idx00, 8 );
+            const __m256d h01 = _mm256_i32gather_pd( grid.heights, idx01, 8 );
+            const __m256d h10 = _mm256_i32gather_pd( grid.heights, idx10, 8 );
+            const __m256d h11 = _mm256_i32gather_pd( grid.heights, idx11, 8 );
+
+            const __m256d h0 = _mm256_add_pd( h00, _mm256_mul_pd( tx, _mm256_sub_pd( h01, h00 ) ) );
+            const __m256d h1 = _mm256_add_pd( h10, _mm256_mul_pd( tx, _mm256_sub_pd( h11, h10 ) ) );
+            _mm256_storeu_pd( dst_heights + p, _mm256_add_pd( h0, _mm256_mul_pd( ty, _mm256_sub_pd( h1, h0 ) ) ) );
+        }
+        return p;
+    }
+#endif
+
+    void SampleHeightsBilinear( const THeightMapGridView& grid, const double* points_xyz, ssize_t num_points, double* dst_heights )
+    {
+        if ( grid.nx_samples < 2 || grid.ny_samples < 2 )
+        {
+            LOCO_CORE_ERROR( "SampleHeightsBilinear >>> heightmap grid requires at least 2x2 samples, got {0}x{1}",
+                             grid.nx_samples, grid.ny_samples );
+            return;
+        }
+
+        // Points are mapped to continuous grid-coordinates (u,v) in [0,nx-1]x[0,ny-1], clamped at the borders
+        const ssize_t nx = grid.nx_samples;
+        const double origin_x = grid.center_x - 0.5 * grid.size_x;
+        const double origin_y = grid.center_y - 0.5 * grid.size_y;
+        const double inv_dx = ( grid.nx_samples - 1 ) / grid.size_x;
+        const double inv_dy = ( grid.ny_samples - 1 ) / grid.size_y;
+        const double max_u = grid.nx_samples - 1;
+        const double max_v = grid.ny_samples - 1;
+        const double max_j0 = grid.nx_samples - 2;
+        const double max_i0 = grid.ny_samples - 2;
+
+        ssize_t p = 0;
+    #if LOCO_RAISIM_HAS_AVX2_KERNEL
+        // Indices of the gather-kernel are 32-bit, so skip it for huge grids
+        static const bool s_CpuHasAvx2 = __builtin_cpu_supports( "avx2" );
+        if ( s_CpuHasAvx2 && grid.nx_samples * grid.ny_samples < std::numeric_limits<int32_t>::max() )
+            p = _SampleHeightsBilinearAvx2( grid, points_xyz, num_points, dst_heights, origin_x, origin_y, inv_dx, inv_dy );
+    #endif
+        // Scalar kernel (remainder, or all points if no simd-support is available). Uses the same
+        // lerp-formulation as the simd-kernel, so both paths give the same results
+        for ( ; p < num_points; p++ )
+        {
+            const double* pts = points_xyz + 3 * p;
+            const double u = std::min( std::max( ( pts[0] - origin_x ) * inv_dx, 0.0 ), max_u );
+            const double v = std::min( std::max( ( pts[1] - origin_y ) * inv_dy, 0.0 ), max_v );
+            const double j0 = std::min( std::floor( u ), max_j0 );
+            const double i0 = std::min( std::floor( v ), max_i0 );
+            const double tx = u - j0;
+            const double ty = v - i0;
+
+            const double* row_0 = grid.heights + (ssize_t)i0 * nx + (ssize_t)j0;
+            const double* row_1 = row_0 + nx;
+            const double h0 = row_0[0] + tx * ( row_0[1] - row_0[0] );
+            const double h1 = row_1[0] + tx * ( row_1[1] - row_1[0] );
+            dst_heights[p] = h0 + ty * ( h1 - h0 );
+        }
+    }
+
     raisim::Mat<3, 3> ComputeEllipsoidInertia( double mass, const TVec3& half_extents )
     {
         return raisim::Mat<3, 3>::getIdentity();
@@ -0,0 +1,74 @@
+#include <loco_hfield_source_raisim.h>
+#include <loco_mapped_file_raisim.h>
+
+#include <cstring>
+
+namespace loco {
+namespace raisimlib {
+
+    size_t HfieldSampleBytes( const eRaisimHfieldSampleType& sample_type )
+    {
+        switch ( sample_type )
+        {
+            case eRaisimHfieldSampleType::FLOAT32 : return sizeof( float );
+            case eRaisimHfieldSampleType::INT16 : return sizeof( int16_t );
+        }
+        return 0;
+    }
+
+    raisim::HeightMap* CreateHfieldFromFile( raisim::World* raisim_world,
+                                             const TVec3& size,
+                                             const TRaisimHfieldFileSource& source )
+    {
+        if ( source.nx_samples < 2 || source.ny_samples < 2 )
+        {
+            LOCO_CORE_ERROR( "CreateHfieldFromFile >>> heightfield from {0} requires at least 2x2 samples, got {1}x{2}",
+                             source.filepath, source.nx_samples, source.ny_samples );
+            return nullptr;
+        }
+
+        TRaisimMappedFile file;
+        if ( !file.Open( source.filepath ) )
+            return nullptr;
+
+        const ssize_t num_samples = source.nx_samples * source.ny_samples;
+        const size_t sample_bytes = HfieldSampleBytes( source.sample_type );
+        if ( file.size() < source.header_bytes + num_samples * sample_bytes )
+        {
+            LOCO_CORE_ERROR( "CreateHfieldFromFile >>> file {0} has {1} bytes, but {2} are required for {3}x{4} samples",
+                             source.filepath, file.size(), source.header_bytes + num_samples * sample_bytes,
+                             source.nx_samples, source.ny_samples );
+            return nullptr;
+        }
+        file.Prefetch( source.header_bytes, num_samples * sample_bytes );
+
+        // Fold the collider's height-scale into the decoding, so each sample is touched only once
+        const double scale = size.z() * source.scale;
+        const double offset = size.z() * source.offset;
+        const uint8_t* samples = file.data() + source.header_bytes;
+        std::vector<double> heights( num_samples );
+        if ( source.sample_type == eRaisimHfieldSampleType::FLOAT32 )
+        {
+            for ( ssize_t i = 0; i < num_samples; i++ )
+            {
+                float sample;
+                std::memcpy( &sample, samples + i * sizeof( float ), sizeof( float ) );
+                heights[i] = sample * scale + offset;
+            }
+        }
+        else
+        {
+            for ( ssize_t i = 0; i < num_samples; i++ )
+            {
+                int16_t sample;
+                std::memcpy( &sample, samples + i * sizeof( int16_t ), sizeof( int16_t ) );
+                heights[i] = sample * scale + offset;
+            }
+        }
+        // The mapping isn't needed anymore, so drop it before raisim makes its own copy
+        file.Close();
+
+        return raisim_world->addHeightMap( source.nx_samples, source.ny_samples, size.x(), size.y(), 0.0, 0.0, heights );
+    }
+
+}}
@@ -0,0 +1,76 @@
+#include <loco_mapped_file_raisim.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimMappedFile::TRaisimMappedFile()
+    {
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    TRaisimMappedFile::~TRaisimMappedFile()
+    {
+        Close();
+    }
+
+    bool TRaisimMappedFile::Open( const std::string& filepath )
+    {
+        Close();
+        const int file_descriptor = open( filepath.c_str(), O_RDONLY );
+        if ( file_descriptor < 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimMappedFile::Open >>> couldn't open file {0}", filepath );
+            return false;
+        }
+
+        struct stat file_stat;
+        if ( fstat( file_descriptor, &file_stat ) != 0 || file_stat.st_size < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimMappedFile::Open >>> file {0} is empty or can't be queried", filepath );
+            close( file_descriptor );
+            return false;
+        }
+
+        void* mapping = mmap( nullptr, file_stat.st_size, PROT_READ, MAP_SHARED, file_descriptor, 0 );
+        // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore
+        close( file_descriptor );
+        if ( mapping == MAP_FAILED )
+        {
+            LOCO_CORE_ERROR( "TRaisimMappedFile::Open >>> couldn't map file {0}", filepath );
+            return false;
+        }
+
+        m_Data = static_cast<const uint8_t*>( mapping );
+        m_Size = file_stat.st_size;
+        m_Filepath = filepath;
+        return true;
+    }
+
+    void TRaisimMappedFile::Close()
+    {
+        if ( m_Data )
+            munmap( const_cast<uint8_t*>( m_Data ), m_Size );
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Filepath = "";
+    }
+
+    void TRaisimMappedFile::Prefetch( size_t offset, size_t num_bytes ) const
+    {
+        if ( !m_Data || offset >= m_Size )
+            return;
+
+        // madvise requires a page-aligned start address
+        const size_t page_size = sysconf( _SC_PAGESIZE );
+        const size_t aligned_offset = offset - ( offset % page_size );
+        const size_t aligned_bytes = std::min( num_bytes + ( offset - aligned_offset ), m_Size - aligned_offset );
+        madvise( const_cast<uint8_t*>( m_Data ) + aligned_offset, aligned_bytes, MADV_WILLNEED );
+    }
+
+}}
@@ -0,0 +1,120 @@
+#include <loco_memory_raisim.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace loco {
+namespace raisimlib {
+
+    size_t TRaisimMemoryReport::object_bytes() const
+    {
+        size_t bytes = 0;
+        for ( const auto& type_bytes : object_bytes_per_type )
+            bytes += type_bytes.second;
+        return bytes;
+    }
+
+    size_t TRaisimMemoryReport::total_bytes() const
+    {
+        return object_bytes() + hfield_bytes + core_hfield_bytes + estimated_mesh_bytes + contact_bytes +
+               estimated_dynamics_bytes + adapter_bytes;
+    }
+
+    TRaisimMemoryReport& TRaisimMemoryReport::operator+=( const TRaisimMemoryReport& other )
+    {
+        num_worlds += other.num_worlds;
+        for ( const auto& type_count : other.num_objects_per_type )
+            num_objects_per_type[type_count.first] += type_count.second;
+        for ( const auto& type_bytes : other.object_bytes_per_type )
+            object_bytes_per_type[type_bytes.first] += type_bytes.second;
+        hfield_bytes += other.hfield_bytes;
+        core_hfield_bytes += other.core_hfield_bytes;
+        hfield_build_copy_bytes = std::max( hfield_build_copy_bytes, other.hfield_build_copy_bytes );
+        estimated_mesh_bytes += other.estimated_mesh_bytes;
+        contact_bytes += other.contact_bytes;
+        estimated_dynamics_bytes += other.estimated_dynamics_bytes;
+        adapter_bytes += other.adapter_bytes;
+
+        // Keep only the largest assets among both reports
+        assets.insert( assets.end(), other.assets.begin(), other.assets.end() );
+        SortAssets();
+        return *this;
+    }
+
+    void TRaisimMemoryReport::SortAssets()
+    {
+        std::stable_sort( assets.begin(), assets.end(), []( const TRaisimAssetMemory& a, const TRaisimAssetMemory& b )
+            {
+                return a.bytes > b.bytes;
+            } );
+        if ( assets.size() > MAX_NUM_ASSETS )
+            assets.resize( MAX_NUM_ASSETS );
+    }
+
+    std::string TRaisimMemoryReport::ToString() const
+    {
+        std::stringstream report;
+        report << "Raisim memory report (" << num_worlds << " world(s))\n";
+        report << "    total-bytes          : " << total_bytes() << "\n";
+        if ( num_worlds > 0 )
+            report << "    bytes-per-world      : " << total_bytes() / num_worlds << "\n";
+        report << "    object-bytes         : " << object_bytes() << "\n";
+        for ( const auto& type_bytes : object_bytes_per_type )
+            report << "        " << type_bytes.first << " : " << type_bytes.second << " ("
+                   << num_objects_per_type.at( type_bytes.first ) << " objects)\n";
+        report << "    hfield-bytes         : " << hfield_bytes << " (+" << hfield_build_copy_bytes << " transient while building)\n";
+        report << "    core-hfield-bytes    : " << core_hfield_bytes << "\n";
+        report << "    mesh-bytes (est.)    : " << estimated_mesh_bytes << "\n";
+        report << "    contact-bytes        : " << contact_bytes << "\n";
+        report << "    dynamics-bytes (est.): " << estimated_dynamics_bytes << "\n";
+        report << "    adapter-bytes        : " << adapter_bytes << "\n";
+        report << "    largest-assets       :\n";
+        for ( const auto& asset : assets )
+            report << "        " << asset.name << " (" << asset.type << ") : " << asset.bytes << "\n";
+        return report.str();
+    }
+
+    std::string ObjectTypeToString( const raisim::ObjectType& type )
+    {
+        switch ( type )
+        {
+            case raisim::ObjectType::SPHERE : return "sphere";
+            case raisim::ObjectType::BOX : return "box";
+            case raisim::ObjectType::CYLINDER : return "cylinder";
+            case raisim::ObjectType::CONE : return "cone";
+            case raisim::ObjectType::CAPSULE : return "capsule";
+            case raisim::ObjectType::MESH : return "mesh";
+            case raisim::ObjectType::HALFSPACE : return "halfspace";
+            case raisim::ObjectType::COMPOUND : return "compound";
+            case raisim::ObjectType::HEIGHTMAP : return "heightmap";
+            case raisim::ObjectType::ARTICULATED_SYSTEM : return "articulated_system";
+            default : return "undefined";
+        }
+    }
+
+    size_t ObjectStructBytes( const raisim::Object* raisim_object )
+    {
+        switch ( raisim_object->getObjectType() )
+        {
+            case raisim::ObjectType::SPHERE : return sizeof( raisim::Sphere );
+            case raisim::ObjectType::BOX : return sizeof( raisim::Box );
+            case raisim::ObjectType::CYLINDER : return sizeof( raisim::Cylinder );
+            case raisim::ObjectType::CAPSULE : return sizeof( raisim::Capsule );
+            case raisim::ObjectType::MESH : return sizeof( raisim::Mesh );
+            case raisim::ObjectType::HALFSPACE : return sizeof( raisim::Ground );
+            case raisim::ObjectType::COMPOUND : return sizeof( raisim::Compound );
+            case raisim::ObjectType::HEIGHTMAP : return sizeof( raisim::HeightMap );
+            case raisim::ObjectType::ARTICULATED_SYSTEM : return sizeof( raisim::ArticulatedSystem );
+            default : return sizeof( raisim::SingleBodyObject );
+        }
+    }
+
+    TRaisimMemoryReport AggregateMemoryReports( const std::vector<TRaisimMemoryReport>& reports )
+    {
+        TRaisimMemoryReport aggregated_report;
+        for ( const auto& report : reports )
+            aggregated_report += report;
+        return aggregated_report;
+    }
+
+}}
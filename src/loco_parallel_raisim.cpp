@@ -0,0 +1,86 @@
+#include <loco_parallel_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimThreadPool::TRaisimThreadPool( ssize_t num_threads )
+    {
+        m_TaskRef = nullptr;
+        m_NumTasks = 0;
+        m_NextTask = 0;
+        m_NumWorkersActive = 0;
+        m_Generation = 0;
+        m_Stop = false;
+
+        if ( num_threads <= 0 )
+            num_threads = std::max( 1u, std::thread::hardware_concurrency() );
+        for ( ssize_t i = 0; i < num_threads - 1; i++ )
+            m_Workers.push_back( std::thread( &TRaisimThreadPool::_WorkerLoop, this ) );
+    }
+
+    TRaisimThreadPool::~TRaisimThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_Mutex );
+            m_Stop = true;
+        }
+        m_CvWorkAvailable.notify_all();
+        for ( auto& worker : m_Workers )
+            worker.join();
+    }
+
+    void TRaisimThreadPool::ParallelFor( ssize_t num_tasks, const std::function<void( ssize_t )>& task )
+    {
+        if ( m_Workers.size() < 1 || num_tasks < 2 )
+        {
+            for ( ssize_t i = 0; i < num_tasks; i++ )
+                task( i );
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( m_Mutex );
+            m_TaskRef = &task;
+            m_NumTasks = num_tasks;
+            m_NextTask = 0;
+            m_NumWorkersActive = m_Workers.size();
+            m_Generation++;
+        }
+        m_CvWorkAvailable.notify_all();
+
+        _RunTasks();
+
+        std::unique_lock<std::mutex> lock( m_Mutex );
+        m_CvWorkDone.wait( lock, [this] { return m_NumWorkersActive == 0; } );
+        m_TaskRef = nullptr;
+    }
+
+    void TRaisimThreadPool::_WorkerLoop()
+    {
+        uint64_t last_generation = 0;
+        while ( true )
+        {
+            {
+                std::unique_lock<std::mutex> lock( m_Mutex );
+                m_CvWorkAvailable.wait( lock, [this, last_generation] { return m_Stop || m_Generation != last_generation; } );
+                if ( m_Stop )
+                    return;
+                last_generation = m_Generation;
+            }
+
+            _RunTasks();
+
+            std::lock_guard<std::mutex> lock( m_Mutex );
+            if ( --m_NumWorkersActive == 0 )
+                m_CvWorkDone.notify_one();
+        }
+    }
+
+    void TRaisimThreadPool::_RunTasks()
+    {
+        const auto& task = *m_TaskRef;
+        for ( ssize_t i = m_NextTask++; i < m_NumTasks; i = m_NextTask++ )
+            task( i );
+    }
+
+}}
@@ -0,0 +1,79 @@
+#include <loco_profiling_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimTimingAccumulator::TRaisimTimingAccumulator()
+    {
+        Reset();
+    }
+
+    void TRaisimTimingAccumulator::AddSample( int64_t elapsed_ns )
+    {
+        elapsed_ns = std::max( elapsed_ns, (int64_t)0 );
+        m_Histogram[_BucketIndex( elapsed_ns )]++;
+        m_Count++;
+        m_TotalNs += elapsed_ns;
+        m_MaxNs = std::max( m_MaxNs, elapsed_ns );
+    }
+
+    void TRaisimTimingAccumulator::Reset()
+    {
+        m_Histogram.fill( 0 );
+        m_Count = 0;
+        m_TotalNs = 0;
+        m_MaxNs = 0;
+    }
+
+    TRaisimTimingStats TRaisimTimingAccumulator::stats() const
+    {
+        auto stats = TRaisimTimingStats();
+        stats.count = m_Count;
+        stats.mean = ( m_Count > 0 ) ? m_TotalNs / (double)m_Count : 0.0;
+        stats.p50 = _Percentile( 0.50 );
+        stats.p99 = _Percentile( 0.99 );
+        stats.max = m_MaxNs;
+        return stats;
+    }
+
+    ssize_t TRaisimTimingAccumulator::_BucketIndex( int64_t elapsed_ns )
+    {
+        // Small values (below the sub-buckets count) get one bucket each
+        if ( elapsed_ns < NUM_SUB_BUCKETS )
+            return elapsed_ns;
+
+        // Otherwise, grab the exponent (msb) and the next NUM_SUB_BUCKETS_BITS bits as sub-bucket
+        const ssize_t exponent = 63 - __builtin_clzll( elapsed_ns );
+        const ssize_t sub_bucket = ( elapsed_ns >> ( exponent - NUM_SUB_BUCKETS_BITS ) ) & ( NUM_SUB_BUCKETS - 1 );
+        return ( exponent - NUM_SUB_BUCKETS_BITS + 1 ) * NUM_SUB_BUCKETS + sub_bucket;
+    }
+
+    double TRaisimTimingAccumulator::_BucketValue( ssize_t bucket_index )
+    {
+        if ( bucket_index < NUM_SUB_BUCKETS )
+            return bucket_index;
+
+        // Midpoint of the range of values covered by the bucket
+        const ssize_t exponent = bucket_index / NUM_SUB_BUCKETS + NUM_SUB_BUCKETS_BITS - 1;
+        const ssize_t sub_bucket = bucket_index % NUM_SUB_BUCKETS;
+        const double bucket_width = std::ldexp( 1.0, exponent - NUM_SUB_BUCKETS_BITS );
+        return ( NUM_SUB_BUCKETS + sub_bucket ) * bucket_width + 0.5 * bucket_width;
+    }
+
+    double TRaisimTimingAccumulator::_Percentile( double quantile ) const
+    {
+        if ( m_Count < 1 )
+            return 0.0;
+
+        const int64_t rank = std::max( (int64_t)1, (int64_t)std::ceil( quantile * m_Count ) );
+        int64_t cumulative = 0;
+        for ( ssize_t i = 0; i < NUM_BUCKETS; i++ )
+        {
+            cumulative += m_Histogram[i];
+            if ( cumulative >= rank )
+                return std::min( _BucketValue( i ), (double)m_MaxNs );
+        }
+        return m_MaxNs;
+    }
+
+}}
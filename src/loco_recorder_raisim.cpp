@@ -0,0 +1,312 @@
+#include <loco_recorder_raisim.h>
+#include <sensors/loco_contact_sensors_raisim.h>
+#include <loco_trace_raisim.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Time the writer thread sleeps for when there are no frames to write
+    constexpr auto RAISIM_RECORDER_IDLE_SLEEP = std::chrono::microseconds( 500 );
+
+    TRaisimTrajectoryRecorder::TRaisimTrajectoryRecorder( const std::vector<std::pair<std::string, raisim::SingleBodyObject*>>& bodies,
+                                                          const std::vector<std::pair<std::string, raisim::ArticulatedSystem*>>& kintrees,
+                                                          const TRaisimContactSensors* contact_sensors_ref,
+                                                          double time_step )
+        : m_FramesBytes( 0 ), m_Head( 0 ), m_Tail( 0 ), m_NumDropped( 0 ), m_Running( false )
+    {
+        m_ContactSensorsRef = contact_sensors_ref;
+        m_RingFrames = 0;
+        m_FileDescriptor = -1;
+        m_ChunkBytes = 0;
+        m_ChunkData = nullptr;
+        m_ChunkOffset = 0;
+        m_WriteOffset = 0;
+
+        std::memset( static_cast<void*>( &m_Header ), 0, sizeof( m_Header ) );
+        std::memcpy( m_Header.magic, RAISIM_RECORDING_MAGIC, sizeof( m_Header.magic ) );
+        m_Header.version = RAISIM_RECORDING_VERSION;
+        m_Header.time_step = time_step;
+        for ( const auto& name_body : bodies )
+        {
+            LOCO_CORE_ASSERT( name_body.second, "TRaisimTrajectoryRecorder >>> raisim object of body {0} should \
+                              be valid (not nullptr)", name_body.first );
+            m_Names += name_body.first + "\n";
+            m_RaisimBodiesRefs.push_back( name_body.second );
+        }
+        for ( const auto& name_kintree : kintrees )
+        {
+            LOCO_CORE_ASSERT( name_kintree.second, "TRaisimTrajectoryRecorder >>> raisim object of kintree {0} \
+                              should be valid (not nullptr)", name_kintree.first );
+            m_Names += name_kintree.first + "\n";
+            m_RaisimKintreesRefs.push_back( name_kintree.second );
+            m_KintreeDims.push_back( name_kintree.second->getGeneralizedCoordinateDim() );
+            m_KintreeDims.push_back( name_kintree.second->getDOF() );
+            m_Header.num_kintree_values += m_KintreeDims[m_KintreeDims.size() - 2] + m_KintreeDims.back();
+        }
+        m_Header.num_bodies = m_RaisimBodiesRefs.size();
+        m_Header.num_kintrees = m_RaisimKintreesRefs.size();
+        m_Header.num_contact_sensors = m_ContactSensorsRef ? m_ContactSensorsRef->num_sensors() : 0;
+
+        m_FrameBytes = sizeof( double ) * ( 1 + m_Header.num_bodies * RAISIM_RECORDING_BODY_DIM + m_Header.num_kintree_values ) +
+                       m_Header.num_contact_sensors * sizeof( TRaisimContactReading );
+        m_Header.frame_bytes = m_FrameBytes;
+        m_Header.names_offset = sizeof( TRaisimRecordingHeader );
+        m_Header.names_bytes = m_Names.size();
+        // Keep dims and frames 8-byte aligned, so they can be read in place from a mapping of the file
+        m_Header.kintree_dims_offset = ( ( m_Header.names_offset + m_Header.names_bytes + 7 ) / 8 ) * 8;
+        m_Header.frames_offset = m_Header.kintree_dims_offset + m_KintreeDims.size() * sizeof( uint64_t );
+    }
+
+    TRaisimTrajectoryRecorder::~TRaisimTrajectoryRecorder()
+    {
+        Stop();
+    }
+
+    bool TRaisimTrajectoryRecorder::Start( const std::string& filepath, ssize_t ring_frames, size_t chunk_bytes,
+                                           const TRaisimRecordingCompression& compression )
+    {
+        if ( is_recording() )
+        {
+            LOCO_CORE_WARN( "TRaisimTrajectoryRecorder::Start >>> already recording, stop the current recording first" );
+            return false;
+        }
+        if ( ring_frames < 1 || chunk_bytes < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::Start >>> ring-buffer and chunk sizes must be positive, \
+                              got ring_frames={0}, chunk_bytes={1}", ring_frames, chunk_bytes );
+            return false;
+        }
+
+        if ( compression.codec == eRaisimRecordingCodec::QUANTIZED &&
+             ( compression.position_resolution <= 0.0 || compression.velocity_resolution <= 0.0 ||
+               compression.force_resolution <= 0.0 || compression.keyframe_interval < 1 ) )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::Start >>> resolutions and keyframe-interval of the \
+                              compression must be positive" );
+            return false;
+        }
+
+        m_FileDescriptor = open( filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+        if ( m_FileDescriptor < 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::Start >>> couldn't create file {0}", filepath );
+            return false;
+        }
+        m_Header.num_frames = 0;
+        m_Header.compression = compression;
+        m_Header.frames_bytes = 0;
+        m_Header.keyframes_offset = 0;
+        m_Header.num_keyframes = 0;
+        if ( pwrite( m_FileDescriptor, &m_Header, sizeof( m_Header ), 0 ) != sizeof( m_Header ) ||
+             pwrite( m_FileDescriptor, m_Names.data(), m_Names.size(), m_Header.names_offset ) != (ssize_t)m_Names.size() ||
+             pwrite( m_FileDescriptor, m_KintreeDims.data(), m_KintreeDims.size() * sizeof( uint64_t ),
+                     m_Header.kintree_dims_offset ) != (ssize_t)( m_KintreeDims.size() * sizeof( uint64_t ) ) )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::Start >>> couldn't write the header of file {0}", filepath );
+            close( m_FileDescriptor );
+            m_FileDescriptor = -1;
+            return false;
+        }
+
+        // Chunks are mapped at multiples of their size, so it has to be a multiple of the page size
+        const size_t page_bytes = sysconf( _SC_PAGESIZE );
+        m_ChunkBytes = ( ( chunk_bytes + page_bytes - 1 ) / page_bytes ) * page_bytes;
+        m_ChunkData = nullptr;
+        m_ChunkOffset = 0;
+        m_WriteOffset = m_Header.frames_offset;
+
+        m_Codec = nullptr;
+        m_KeyframeOffsets.clear();
+        m_FramesBytes.store( 0, std::memory_order_relaxed );
+        if ( compression.codec == eRaisimRecordingCodec::QUANTIZED )
+        {
+            m_Codec = std::make_unique<TRaisimRecordingCodec>( m_Header, m_KintreeDims.data() );
+            m_Values.assign( m_Codec->num_values(), 0 );
+            m_PrevValues.assign( m_Codec->num_values(), 0 );
+            m_EncodedBytes.clear();
+            m_EncodedBytes.reserve( 2 * m_FrameBytes );
+        }
+
+        // The ring is allocated (and touched) once here, so recording never allocates on the sim thread
+        m_RingFrames = ring_frames;
+        m_Ring.assign( m_RingFrames * m_FrameBytes, 0 );
+        m_Head.store( 0, std::memory_order_relaxed );
+        m_Tail.store( 0, std::memory_order_relaxed );
+        m_NumDropped.store( 0, std::memory_order_relaxed );
+        m_Running.store( true, std::memory_order_release );
+        m_Writer = std::thread( &TRaisimTrajectoryRecorder::_WriterLoop, this );
+        return true;
+    }
+
+    void TRaisimTrajectoryRecorder::Record( double time )
+    {
+        if ( !is_recording() )
+            return;
+
+        const int64_t head = m_Head.load( std::memory_order_relaxed );
+        if ( head - m_Tail.load( std::memory_order_acquire ) >= m_RingFrames )
+        {
+            // Never block the sim thread on the writer, just account for the lost frame
+            m_NumDropped.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+
+        double* frame = reinterpret_cast<double*>( m_Ring.data() + ( head % m_RingFrames ) * m_FrameBytes );
+        *frame++ = time;
+        for ( auto raisim_body : m_RaisimBodiesRefs )
+        {
+            const auto& position = raisim_body->getPosition_W();
+            const auto& quaternion = raisim_body->getQuat();
+            const auto& linear_vel = raisim_body->getLinearVelocity_W();
+            const auto& angular_vel = raisim_body->getAngularVelocity_W();
+            for ( ssize_t j = 0; j < 3; j++ )
+            {
+                frame[j] = position[j];
+                frame[7 + j] = linear_vel[j];
+                frame[10 + j] = angular_vel[j];
+            }
+            for ( ssize_t j = 0; j < 4; j++ )
+                frame[3 + j] = quaternion[j];
+            frame += RAISIM_RECORDING_BODY_DIM;
+        }
+        for ( auto raisim_kintree : m_RaisimKintreesRefs )
+        {
+            const auto& gc = raisim_kintree->getGeneralizedCoordinate().e();
+            const auto& gv = raisim_kintree->getGeneralizedVelocity().e();
+            std::memcpy( frame, gc.data(), gc.size() * sizeof( double ) );
+            frame += gc.size();
+            std::memcpy( frame, gv.data(), gv.size() * sizeof( double ) );
+            frame += gv.size();
+        }
+        if ( m_Header.num_contact_sensors > 0 )
+            std::memcpy( frame, m_ContactSensorsRef->readings(), m_Header.num_contact_sensors * sizeof( TRaisimContactReading ) );
+
+        m_Head.store( head + 1, std::memory_order_release );
+    }
+
+    bool TRaisimTrajectoryRecorder::Stop()
+    {
+        if ( !is_recording() )
+            return false;
+
+        // The writer drains the ring before exiting, so every recorded frame makes it to the file
+        m_Running.store( false, std::memory_order_release );
+        if ( m_Writer.joinable() )
+            m_Writer.join();
+        _UnmapChunk();
+
+        m_Header.num_frames = m_Tail.load( std::memory_order_acquire );
+        m_Header.frames_bytes = m_WriteOffset - m_Header.frames_offset;
+        uint64_t file_bytes = m_WriteOffset;
+        bool success = true;
+        if ( m_Codec )
+        {
+            // Keyframe offsets go right after the frames, so seeking never has to scan the whole file
+            m_Header.keyframes_offset = ( ( m_WriteOffset + 7 ) / 8 ) * 8;
+            m_Header.num_keyframes = m_KeyframeOffsets.size();
+            const ssize_t keyframes_bytes = m_KeyframeOffsets.size() * sizeof( uint64_t );
+            file_bytes = m_Header.keyframes_offset + keyframes_bytes;
+            success = pwrite( m_FileDescriptor, m_KeyframeOffsets.data(), keyframes_bytes, m_Header.keyframes_offset ) == keyframes_bytes;
+        }
+        success = success && pwrite( m_FileDescriptor, &m_Header, sizeof( m_Header ), 0 ) == sizeof( m_Header ) &&
+                  ftruncate( m_FileDescriptor, file_bytes ) == 0;
+        if ( !success )
+            LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::Stop >>> couldn't finalize the recording file" );
+        if ( m_NumDropped.load( std::memory_order_relaxed ) > 0 )
+            LOCO_CORE_WARN( "TRaisimTrajectoryRecorder::Stop >>> dropped {0} frames (ring-buffer was full), \
+                             consider using a larger ring-buffer", m_NumDropped.load( std::memory_order_relaxed ) );
+        close( m_FileDescriptor );
+        m_FileDescriptor = -1;
+        return success;
+    }
+
+    void TRaisimTrajectoryRecorder::_WriterLoop()
+    {
+        while ( true )
+        {
+            // Read the flag before the head, so frames recorded right before stopping are still drained
+            const bool running = m_Running.load( std::memory_order_acquire );
+            const int64_t head = m_Head.load( std::memory_order_acquire );
+            int64_t tail = m_Tail.load( std::memory_order_relaxed );
+            if ( tail == head )
+            {
+                if ( !running )
+                    break;
+                std::this_thread::sleep_for( RAISIM_RECORDER_IDLE_SLEEP );
+                continue;
+            }
+
+            for ( ; tail < head; tail++ )
+            {
+                if ( !_WriteFrame( m_Ring.data() + ( tail % m_RingFrames ) * m_FrameBytes, tail ) )
+                {
+                    // Stop consuming, so the sim thread just keeps dropping frames until the recording is stopped
+                    LOCO_CORE_ERROR( "TRaisimTrajectoryRecorder::_WriterLoop >>> couldn't write frame {0}", tail );
+                    return;
+                }
+                m_Tail.store( tail + 1, std::memory_order_release );
+            }
+        }
+    }
+
+    bool TRaisimTrajectoryRecorder::_WriteFrame( const uint8_t* frame, int64_t frame_index )
+    {
+        bool success = false;
+        if ( !m_Codec )
+        {
+            success = _WriteBytes( frame, m_FrameBytes );
+        }
+        else
+        {
+            const bool is_keyframe = ( frame_index % m_Header.compression.keyframe_interval ) == 0;
+            const uint64_t frame_offset = m_WriteOffset - m_Header.frames_offset;
+            m_Codec->Quantize( reinterpret_cast<const double*>( frame ), m_Values.data() );
+            m_EncodedBytes.clear();
+            m_Codec->Encode( m_Values.data(), is_keyframe ? nullptr : m_PrevValues.data(), m_EncodedBytes );
+            std::swap( m_Values, m_PrevValues );
+            success = _WriteBytes( m_EncodedBytes.data(), m_EncodedBytes.size() );
+            // Only frames that made it to the file get a keyframe entry, so the index never points past the frames
+            if ( success && is_keyframe )
+                m_KeyframeOffsets.push_back( frame_offset );
+        }
+        m_FramesBytes.store( m_WriteOffset - m_Header.frames_offset, std::memory_order_relaxed );
+        return success;
+    }
+
+    bool TRaisimTrajectoryRecorder::_WriteBytes( const uint8_t* data, size_t num_bytes )
+    {
+        while ( num_bytes > 0 )
+        {
+            if ( !m_ChunkData || m_WriteOffset >= m_ChunkOffset + m_ChunkBytes )
+            {
+                _UnmapChunk();
+                m_ChunkOffset = ( m_WriteOffset / m_ChunkBytes ) * m_ChunkBytes;
+                if ( ftruncate( m_FileDescriptor, m_ChunkOffset + m_ChunkBytes ) != 0 )
+                    return false;
+                void* mapping = mmap( nullptr, m_ChunkBytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_FileDescriptor, m_ChunkOffset );
+                if ( mapping == MAP_FAILED )
+                    return false;
+                m_ChunkData = static_cast<uint8_t*>( mapping );
+            }
+
+            const size_t num_bytes_chunk = std::min<size_t>( num_bytes, m_ChunkOffset + m_ChunkBytes - m_WriteOffset );
+            std::memcpy( m_ChunkData + ( m_WriteOffset - m_ChunkOffset ), data, num_bytes_chunk );
+            data += num_bytes_chunk;
+            num_bytes -= num_bytes_chunk;
+            m_WriteOffset += num_bytes_chunk;
+        }
+        return true;
+    }
+
+    void TRaisimTrajectoryRecorder::_UnmapChunk()
+    {
+        if ( m_ChunkData )
+            munmap( m_ChunkData, m_ChunkBytes );
+        m_ChunkData = nullptr;
+    }
+
+}}
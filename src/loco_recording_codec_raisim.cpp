@@ -0,0 +1,192 @@
+#include <loco_recording_codec_raisim.h>
+#include <loco_recorder_raisim.h>
+#include <sensors/loco_contact_sensors_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Contact readings are recorded as-is, so they're handled as 7 values (force, torque and count)
+    static_assert( sizeof( TRaisimContactReading ) == 7 * sizeof( double ), "TRaisimRecordingCodec >>> unexpected \
+                   layout of contact readings" );
+
+    static inline uint64_t ZigZagEncode( int64_t value )
+    {
+        return ( static_cast<uint64_t>( value ) << 1 ) ^ static_cast<uint64_t>( value >> 63 );
+    }
+
+    static inline int64_t ZigZagDecode( uint64_t value )
+    {
+        return static_cast<int64_t>( value >> 1 ) ^ -static_cast<int64_t>( value & 1 );
+    }
+
+    static inline void WriteVarint( uint64_t value, std::vector<uint8_t>& dst_bytes )
+    {
+        while ( value >= 0x80 )
+        {
+            dst_bytes.push_back( static_cast<uint8_t>( value | 0x80 ) );
+            value >>= 7;
+        }
+        dst_bytes.push_back( static_cast<uint8_t>( value ) );
+    }
+
+    static inline const uint8_t* ReadVarint( const uint8_t* src_bytes, const uint8_t* src_bytes_end, uint64_t& dst_value )
+    {
+        dst_value = 0;
+        for ( uint32_t shift = 0; src_bytes < src_bytes_end && shift < 64; shift += 7 )
+        {
+            const uint8_t byte = *src_bytes++;
+            dst_value |= static_cast<uint64_t>( byte & 0x7f ) << shift;
+            if ( !( byte & 0x80 ) )
+                return src_bytes;
+        }
+        return nullptr;
+    }
+
+    TRaisimRecordingCodec::TRaisimRecordingCodec( const TRaisimRecordingHeader& header, const uint64_t* kintree_dims )
+    {
+        m_Channels.push_back( eChannel::TIME );
+        for ( ssize_t i = 0; i < header.num_bodies; i++ )
+        {
+            m_Channels.insert( m_Channels.end(), 3, eChannel::POSITION );
+            m_Channels.insert( m_Channels.end(), 4, eChannel::QUATERNION );
+            m_Channels.insert( m_Channels.end(), 6, eChannel::VELOCITY );
+        }
+        for ( ssize_t i = 0; i < header.num_kintrees; i++ )
+        {
+            m_Channels.insert( m_Channels.end(), kintree_dims[2 * i + 0], eChannel::POSITION );
+            m_Channels.insert( m_Channels.end(), kintree_dims[2 * i + 1], eChannel::VELOCITY );
+        }
+        for ( ssize_t i = 0; i < header.num_contact_sensors; i++ )
+        {
+            m_Channels.insert( m_Channels.end(), 6, eChannel::FORCE );
+            m_Channels.push_back( eChannel::COUNT );
+        }
+
+        m_Resolutions[(int)eChannel::TIME] = RAISIM_RECORDING_TIME_RESOLUTION;
+        m_Resolutions[(int)eChannel::POSITION] = header.compression.position_resolution;
+        m_Resolutions[(int)eChannel::QUATERNION] = 1.0;
+        m_Resolutions[(int)eChannel::VELOCITY] = header.compression.velocity_resolution;
+        m_Resolutions[(int)eChannel::FORCE] = header.compression.force_resolution;
+        m_Resolutions[(int)eChannel::COUNT] = 1.0;
+        m_QuaternionMax = ( int64_t( 1 ) << std::min<uint32_t>( std::max<uint32_t>( header.compression.quaternion_bits, 2 ), 30 ) ) - 1;
+    }
+
+    void TRaisimRecordingCodec::Quantize( const double* frame, int64_t* dst_values ) const
+    {
+        for ( ssize_t i = 0; i < m_Channels.size(); i++ )
+        {
+            const auto channel = m_Channels[i];
+            if ( channel == eChannel::COUNT )
+            {
+                std::memcpy( &dst_values[i], &frame[i], sizeof( int64_t ) );
+            }
+            else if ( channel == eChannel::QUATERNION )
+            {
+                // Smallest-three: drop the largest component (recovered from the unit norm), flipping the sign of
+                // the quaternion so it's positive, and store the other three (within +-1/sqrt(2)) in a fixed range
+                ssize_t largest = 0;
+                for ( ssize_t j = 1; j < 4; j++ )
+                    if ( std::abs( frame[i + j] ) > std::abs( frame[i + largest] ) )
+                        largest = j;
+                const double sign = frame[i + largest] < 0.0 ? -1.0 : 1.0;
+                dst_values[i] = largest;
+                for ( ssize_t j = 0, k = 1; j < 4; j++ )
+                {
+                    if ( j == largest )
+                        continue;
+                    const double normalized = ( sign * frame[i + j] * M_SQRT1_2 + 0.5 );
+                    dst_values[i + k++] = std::llround( std::min( std::max( normalized, 0.0 ), 1.0 ) * m_QuaternionMax );
+                }
+                i += 3;
+            }
+            else
+            {
+                dst_values[i] = std::llround( frame[i] / m_Resolutions[(int)channel] );
+            }
+        }
+    }
+
+    void TRaisimRecordingCodec::Dequantize( const int64_t* values, double* dst_frame ) const
+    {
+        for ( ssize_t i = 0; i < m_Channels.size(); i++ )
+        {
+            const auto channel = m_Channels[i];
+            if ( channel == eChannel::COUNT )
+            {
+                std::memcpy( &dst_frame[i], &values[i], sizeof( int64_t ) );
+            }
+            else if ( channel == eChannel::QUATERNION )
+            {
+                const ssize_t largest = values[i] & 3;
+                double sum_squares = 0.0;
+                for ( ssize_t j = 0, k = 1; j < 4; j++ )
+                {
+                    if ( j == largest )
+                        continue;
+                    const double component = ( static_cast<double>( values[i + k++] ) / m_QuaternionMax - 0.5 ) * M_SQRT2;
+                    dst_frame[i + j] = component;
+                    sum_squares += component * component;
+                }
+                dst_frame[i + largest] = std::sqrt( std::max( 1.0 - sum_squares, 0.0 ) );
+                i += 3;
+            }
+            else
+            {
+                dst_frame[i] = values[i] * m_Resolutions[(int)channel];
+            }
+        }
+    }
+
+    void TRaisimRecordingCodec::Encode( const int64_t* values, const int64_t* prev_values, std::vector<uint8_t>& dst_bytes ) const
+    {
+        const ssize_t num_values = m_Channels.size();
+        if ( !prev_values )
+        {
+            for ( ssize_t i = 0; i < num_values; i++ )
+                WriteVarint( ZigZagEncode( values[i] ), dst_bytes );
+            return;
+        }
+
+        const size_t mask_start = dst_bytes.size();
+        dst_bytes.resize( mask_start + ( num_values + 7 ) / 8, 0 );
+        for ( ssize_t i = 0; i < num_values; i++ )
+        {
+            const int64_t delta = values[i] - prev_values[i];
+            if ( delta == 0 )
+                continue;
+            dst_bytes[mask_start + i / 8] |= static_cast<uint8_t>( 1 << ( i % 8 ) );
+            WriteVarint( ZigZagEncode( delta ), dst_bytes );
+        }
+    }
+
+    const uint8_t* TRaisimRecordingCodec::Decode( const uint8_t* src_bytes, const uint8_t* src_bytes_end,
+                                                  const int64_t* prev_values, int64_t* dst_values ) const
+    {
+        const ssize_t num_values = m_Channels.size();
+        uint64_t encoded = 0;
+        if ( !prev_values )
+        {
+            for ( ssize_t i = 0; i < num_values && src_bytes; i++ )
+            {
+                src_bytes = ReadVarint( src_bytes, src_bytes_end, encoded );
+                dst_values[i] = ZigZagDecode( encoded );
+            }
+            return src_bytes;
+        }
+
+        const uint8_t* mask = src_bytes;
+        src_bytes += ( num_values + 7 ) / 8;
+        if ( src_bytes > src_bytes_end )
+            return nullptr;
+        for ( ssize_t i = 0; i < num_values && src_bytes; i++ )
+        {
+            dst_values[i] = prev_values[i];
+            if ( !( mask[i / 8] & ( 1 << ( i % 8 ) ) ) )
+                continue;
+            src_bytes = ReadVarint( src_bytes, src_bytes_end, encoded );
+            dst_values[i] += ZigZagDecode( encoded );
+        }
+        return src_bytes;
+    }
+
+}}
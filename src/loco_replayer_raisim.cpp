@@ -0,0 +1,287 @@
+#include <loco_replayer_raisim.h>
+#include <sensors/loco_contact_sensors_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Number of frames prefetched when opening a recording
+    constexpr uint64_t RAISIM_REPLAYER_PREFETCH_FRAMES = 1024;
+
+    TRaisimTrajectoryReplayer::TRaisimTrajectoryReplayer()
+    {
+        m_Header = nullptr;
+        m_KeyframeOffsets = nullptr;
+        m_DecodedFrameIndex = -1;
+        m_DecodeCursor = nullptr;
+    }
+
+    bool TRaisimTrajectoryReplayer::Open( const std::string& filepath )
+    {
+        m_Header = nullptr;
+        m_BodyNames.clear();
+        m_KintreeNames.clear();
+        m_RaisimBodiesRefs.clear();
+        m_RaisimKintreesRefs.clear();
+        m_KintreeOffsets.clear();
+        m_KintreeNumGc.clear();
+        m_KintreeNumGv.clear();
+        m_ScratchGc.clear();
+        m_ScratchGv.clear();
+        m_Codec = nullptr;
+        m_KeyframeOffsets = nullptr;
+        m_DecodedFrameIndex = -1;
+        m_DecodeCursor = nullptr;
+        if ( !m_File.Open( filepath ) )
+            return false;
+
+        auto header = reinterpret_cast<const TRaisimRecordingHeader*>( m_File.data() );
+        if ( m_File.size() < sizeof( TRaisimRecordingHeader ) ||
+             std::memcmp( header->magic, RAISIM_RECORDING_MAGIC, sizeof( header->magic ) ) != 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> file {0} is not a recording", filepath );
+            m_File.Close();
+            return false;
+        }
+        if ( header->version != RAISIM_RECORDING_VERSION )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> recording {0} has version {1}, but version {2} \
+                              is required (record it again)", filepath, header->version, RAISIM_RECORDING_VERSION );
+            m_File.Close();
+            return false;
+        }
+        const uint64_t expected_frame_bytes = sizeof( double ) * ( 1 + header->num_bodies * RAISIM_RECORDING_BODY_DIM +
+                                                                    header->num_kintree_values ) +
+                                              header->num_contact_sensors * sizeof( TRaisimContactReading );
+        const bool is_quantized = header->compression.codec == eRaisimRecordingCodec::QUANTIZED;
+        const uint32_t keyframe_interval = header->compression.keyframe_interval;
+        const bool frames_fit = is_quantized ?
+                ( keyframe_interval > 0 &&
+                  header->num_keyframes == ( header->num_frames + keyframe_interval - 1 ) / keyframe_interval &&
+                  header->frames_offset + header->frames_bytes <= header->keyframes_offset &&
+                  header->keyframes_offset + header->num_keyframes * sizeof( uint64_t ) <= m_File.size() ) :
+                ( header->compression.codec == eRaisimRecordingCodec::RAW &&
+                  header->frames_offset + header->num_frames * header->frame_bytes <= m_File.size() );
+        if ( header->frame_bytes != expected_frame_bytes || !frames_fit ||
+             header->names_offset + header->names_bytes > header->kintree_dims_offset ||
+             header->kintree_dims_offset + 2 * header->num_kintrees * sizeof( uint64_t ) > header->frames_offset )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> recording {0} is corrupted or was not stopped \
+                              properly", filepath );
+            m_File.Close();
+            return false;
+        }
+
+        // Split the names block into the bodies' names followed by the kintrees' names
+        const char* names = reinterpret_cast<const char*>( m_File.data() + header->names_offset );
+        std::vector<std::string> all_names;
+        for ( size_t start = 0, end = 0; end < header->names_bytes; end++ )
+        {
+            if ( names[end] != '\n' )
+                continue;
+            all_names.push_back( std::string( names + start, end - start ) );
+            start = end + 1;
+        }
+        if ( all_names.size() != header->num_bodies + header->num_kintrees )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> recording {0} has {1} names, but {2} bodies and \
+                              {3} kintrees", filepath, all_names.size(), header->num_bodies, header->num_kintrees );
+            m_File.Close();
+            return false;
+        }
+        // The dims of the kintrees give the layout of every frame, so they must add up to the recorded values (each
+        // one is checked on its own first, so corrupted dims can't overflow the sum)
+        const uint64_t* kintree_dims = reinterpret_cast<const uint64_t*>( m_File.data() + header->kintree_dims_offset );
+        uint64_t num_kintree_values = 0;
+        bool dims_valid = true;
+        for ( ssize_t i = 0; i < 2 * header->num_kintrees && dims_valid; i++ )
+        {
+            dims_valid = ( kintree_dims[i] <= header->num_kintree_values - num_kintree_values );
+            num_kintree_values += dims_valid ? kintree_dims[i] : 0;
+        }
+        if ( !dims_valid || num_kintree_values != header->num_kintree_values )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> recording {0} is corrupted (dims of the kintrees \
+                              don't add up to {1} values)", filepath, header->num_kintree_values );
+            m_File.Close();
+            return false;
+        }
+
+        // Frames are decoded starting from these offsets, so all of them must point into the frames block
+        if ( is_quantized )
+        {
+            const uint64_t* keyframe_offsets = reinterpret_cast<const uint64_t*>( m_File.data() + header->keyframes_offset );
+            for ( ssize_t k = 0; k < header->num_keyframes; k++ )
+            {
+                if ( keyframe_offsets[k] < header->frames_bytes )
+                    continue;
+                LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::Open >>> recording {0} is corrupted (keyframe {1} at \
+                                  offset {2}, past the {3} bytes of frames)", filepath, k, keyframe_offsets[k], header->frames_bytes );
+                m_File.Close();
+                return false;
+            }
+        }
+
+        m_BodyNames.assign( all_names.begin(), all_names.begin() + header->num_bodies );
+        m_KintreeNames.assign( all_names.begin() + header->num_bodies, all_names.end() );
+        m_RaisimBodiesRefs.assign( header->num_bodies, nullptr );
+        m_RaisimKintreesRefs.assign( header->num_kintrees, nullptr );
+
+        ssize_t offset = header->num_bodies * RAISIM_RECORDING_BODY_DIM;
+        for ( ssize_t i = 0; i < header->num_kintrees; i++ )
+        {
+            m_KintreeOffsets.push_back( offset );
+            m_KintreeNumGc.push_back( kintree_dims[2 * i + 0] );
+            m_KintreeNumGv.push_back( kintree_dims[2 * i + 1] );
+            m_ScratchGc.push_back( Eigen::VectorXd::Zero( m_KintreeNumGc.back() ) );
+            m_ScratchGv.push_back( Eigen::VectorXd::Zero( m_KintreeNumGv.back() ) );
+            offset += m_KintreeNumGc.back() + m_KintreeNumGv.back();
+        }
+
+        if ( is_quantized )
+        {
+            m_Codec = std::make_unique<TRaisimRecordingCodec>( *header, kintree_dims );
+            m_KeyframeOffsets = reinterpret_cast<const uint64_t*>( m_File.data() + header->keyframes_offset );
+            m_DecodedFrame.assign( header->frame_bytes / sizeof( double ), 0.0 );
+            m_DecodedValues.assign( m_Codec->num_values(), 0 );
+            m_ScratchValues.assign( m_Codec->num_values(), 0 );
+        }
+
+        m_Header = header;
+        // Replays usually start at the beginning, so have the OS read the first frames ahead (the rest are faulted
+        // in lazily, with the OS' own read-ahead)
+        const uint64_t prefetch_bytes = std::min<uint64_t>( m_Header->num_frames, RAISIM_REPLAYER_PREFETCH_FRAMES ) * m_Header->frame_bytes;
+        m_File.Prefetch( m_Header->frames_offset, is_quantized ? std::min( prefetch_bytes, m_Header->frames_bytes ) : prefetch_bytes );
+        return true;
+    }
+
+    bool TRaisimTrajectoryReplayer::BindBody( const std::string& name, raisim::SingleBodyObject* raisim_body_ref )
+    {
+        for ( ssize_t i = 0; i < m_BodyNames.size(); i++ )
+        {
+            if ( m_BodyNames[i] != name )
+                continue;
+            m_RaisimBodiesRefs[i] = raisim_body_ref;
+            return true;
+        }
+        return false;
+    }
+
+    bool TRaisimTrajectoryReplayer::BindKintree( const std::string& name, raisim::ArticulatedSystem* raisim_kintree_ref )
+    {
+        for ( ssize_t i = 0; i < m_KintreeNames.size(); i++ )
+        {
+            if ( m_KintreeNames[i] != name )
+                continue;
+            if ( raisim_kintree_ref && ( raisim_kintree_ref->getGeneralizedCoordinateDim() != m_KintreeNumGc[i] ||
+                                         raisim_kintree_ref->getDOF() != m_KintreeNumGv[i] ) )
+            {
+                LOCO_CORE_WARN( "TRaisimTrajectoryReplayer::BindKintree >>> kintree {0} was recorded with a different \
+                                 number of coordinates|dofs, so it won't be replayed", name );
+                return false;
+            }
+            m_RaisimKintreesRefs[i] = raisim_kintree_ref;
+            return true;
+        }
+        return false;
+    }
+
+    void TRaisimTrajectoryReplayer::ApplyFrame( ssize_t frame_index )
+    {
+        LOCO_CORE_ASSERT( m_Header, "TRaisimTrajectoryReplayer::ApplyFrame >>> there's no recording opened" );
+        LOCO_CORE_ASSERT( frame_index >= 0 && frame_index < num_frames(), "TRaisimTrajectoryReplayer::ApplyFrame >>> \
+                          frame {0} out of range [0, {1})", frame_index, num_frames() );
+
+        const double* values = _frame( frame_index ) + 1;
+        for ( ssize_t i = 0; i < m_RaisimBodiesRefs.size(); i++ )
+        {
+            auto raisim_body = m_RaisimBodiesRefs[i];
+            if ( !raisim_body )
+                continue;
+            const double* state = values + i * RAISIM_RECORDING_BODY_DIM;
+            raisim_body->setPosition( state[0], state[1], state[2] );
+            raisim_body->setOrientation( Eigen::Vector4d( state[3], state[4], state[5], state[6] ) );
+            raisim_body->setVelocity( state[7], state[8], state[9], state[10], state[11], state[12] );
+        }
+        for ( ssize_t i = 0; i < m_RaisimKintreesRefs.size(); i++ )
+        {
+            auto raisim_kintree = m_RaisimKintreesRefs[i];
+            if ( !raisim_kintree )
+                continue;
+            const double* state = values + m_KintreeOffsets[i];
+            m_ScratchGc[i] = Eigen::Map<const Eigen::VectorXd>( state, m_KintreeNumGc[i] );
+            m_ScratchGv[i] = Eigen::Map<const Eigen::VectorXd>( state + m_KintreeNumGc[i], m_KintreeNumGv[i] );
+            raisim_kintree->setState( m_ScratchGc[i], m_ScratchGv[i] );
+        }
+    }
+
+    const double* TRaisimTrajectoryReplayer::_frame( ssize_t frame_index ) const
+    {
+        if ( !m_Codec )
+            return reinterpret_cast<const double*>( m_File.data() + m_Header->frames_offset + frame_index * m_Header->frame_bytes );
+        if ( frame_index == m_DecodedFrameIndex )
+            return m_DecodedFrame.data();
+
+        // Going forward within the same block continues from the last decoded frame, otherwise start at the keyframe
+        const ssize_t keyframe_interval = m_Header->compression.keyframe_interval;
+        const ssize_t block_index = frame_index / keyframe_interval;
+        const uint8_t* frames_begin = m_File.data() + m_Header->frames_offset;
+        const uint8_t* frames_end = frames_begin + m_Header->frames_bytes;
+        if ( m_DecodedFrameIndex < 0 || m_DecodedFrameIndex > frame_index || m_DecodedFrameIndex / keyframe_interval != block_index )
+        {
+            m_DecodeCursor = m_Codec->Decode( frames_begin + m_KeyframeOffsets[block_index], frames_end, nullptr, m_DecodedValues.data() );
+            m_DecodedFrameIndex = block_index * keyframe_interval;
+        }
+        while ( m_DecodeCursor && m_DecodedFrameIndex < frame_index )
+        {
+            m_DecodeCursor = m_Codec->Decode( m_DecodeCursor, frames_end, m_DecodedValues.data(), m_ScratchValues.data() );
+            std::swap( m_DecodedValues, m_ScratchValues );
+            m_DecodedFrameIndex++;
+        }
+        if ( !m_DecodeCursor )
+        {
+            LOCO_CORE_ERROR( "TRaisimTrajectoryReplayer::_frame >>> frame {0} of recording {1} is corrupted",
+                             frame_index, m_File.filepath() );
+            m_DecodedFrameIndex = -1;
+            std::fill( m_DecodedFrame.begin(), m_DecodedFrame.end(), 0.0 );
+            return m_DecodedFrame.data();
+        }
+
+        m_Codec->Dequantize( m_DecodedValues.data(), m_DecodedFrame.data() );
+        return m_DecodedFrame.data();
+    }
+
+    ssize_t TRaisimTrajectoryReplayer::FindFrame( double time ) const
+    {
+        // Frames are recorded in time order, so binary-search them (reading only a few pages of the mapping). When
+        // quantized, search the keyframes first and then go through the frames of the found block in order
+        ssize_t low = 0, high = num_frames();
+        if ( m_Codec )
+        {
+            const ssize_t keyframe_interval = m_Header->compression.keyframe_interval;
+            ssize_t block_low = 0, block_high = m_Header->num_keyframes;
+            while ( block_low < block_high )
+            {
+                const ssize_t mid = ( block_low + block_high ) / 2;
+                if ( frame_time( mid * keyframe_interval ) <= time )
+                    block_low = mid + 1;
+                else
+                    block_high = mid;
+            }
+            low = std::max<ssize_t>( block_low - 1, 0 ) * keyframe_interval;
+            high = std::min<ssize_t>( low + keyframe_interval, num_frames() );
+            while ( low < high && frame_time( low ) <= time )
+                low++;
+            return std::max<ssize_t>( low - 1, 0 );
+        }
+        while ( low < high )
+        {
+            const ssize_t mid = ( low + high ) / 2;
+            if ( frame_time( mid ) <= time )
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return std::max<ssize_t>( low - 1, 0 );
+    }
+
+}}
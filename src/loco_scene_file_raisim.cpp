@@ -0,0 +1,316 @@
+#include <loco_scene_file_raisim.h>
+#include <primitives/loco_single_body_adapter.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace loco {
+namespace raisimlib {
+
+    // Magic bytes at the start of every precompiled-scene file
+    constexpr char RAISIM_SCENE_FILE_MAGIC[8] = { 'L', 'O', 'C', 'O', 'R', 'S', 'C', 'N' };
+
+    // Rounds the given offset up to a multiple of 8 bytes (so doubles in the mapping are properly aligned)
+    static uint64_t AlignOffset( uint64_t offset )
+    {
+        return ( offset + 7 ) & ~uint64_t( 7 );
+    }
+
+    // Offset basis and prime of the 64-bit FNV-1a hash
+    constexpr uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+    constexpr uint64_t FNV1A_PRIME = 1099511628211ull;
+
+    static void HashBytes( uint64_t& hash, const void* data, size_t num_bytes )
+    {
+        const auto bytes = static_cast<const uint8_t*>( data );
+        for ( size_t i = 0; i < num_bytes; i++ )
+        {
+            hash ^= bytes[i];
+            hash *= FNV1A_PRIME;
+        }
+    }
+
+    // Scalars are hashed as doubles, so the hash doesn't depend on the precision loco was built with
+    static void HashScalar( uint64_t& hash, double value )
+    {
+        HashBytes( hash, &value, sizeof( value ) );
+    }
+
+    // Max. number of values sampled from each mesh|heightfield buffer, so hashing is cheap regardless of its size
+    constexpr size_t SCENE_HASH_MAX_SAMPLES = 64;
+
+    // Hashes the size of the given buffer and a bounded number of evenly spaced values (plus the last one)
+    template <typename T>
+    static void HashSampledValues( uint64_t& hash, const std::vector<T>& values )
+    {
+        const uint64_t num_values = values.size();
+        HashBytes( hash, &num_values, sizeof( num_values ) );
+        if ( values.empty() )
+            return;
+        const size_t stride = std::max<size_t>( 1, values.size() / SCENE_HASH_MAX_SAMPLES );
+        for ( size_t i = 0; i < values.size(); i += stride )
+            HashScalar( hash, values[i] );
+        HashScalar( hash, values.back() );
+    }
+
+    uint64_t ComputeSceneBodyHash( const TShapeData& shape_data, const TInertialData& inertia_data )
+    {
+        uint64_t hash = FNV1A_OFFSET_BASIS;
+        const int32_t shape_type = (int32_t)shape_data.type;
+        HashBytes( hash, &shape_type, sizeof( shape_type ) );
+        for ( ssize_t i = 0; i < 3; i++ )
+            HashScalar( hash, shape_data.size[i] );
+
+        HashBytes( hash, shape_data.mesh_data.filename.data(), shape_data.mesh_data.filename.size() );
+        HashSampledValues( hash, shape_data.mesh_data.vertices );
+        HashSampledValues( hash, shape_data.mesh_data.faces );
+
+        const int64_t hfield_dims[2] = { shape_data.hfield_data.nWidthSamples, shape_data.hfield_data.nDepthSamples };
+        HashBytes( hash, hfield_dims, sizeof( hfield_dims ) );
+        HashSampledValues( hash, shape_data.hfield_data.heights );
+
+        HashScalar( hash, inertia_data.mass );
+        HashScalar( hash, inertia_data.ixx );
+        HashScalar( hash, inertia_data.iyy );
+        HashScalar( hash, inertia_data.izz );
+        HashScalar( hash, inertia_data.ixy );
+        HashScalar( hash, inertia_data.ixz );
+        HashScalar( hash, inertia_data.iyz );
+        return hash;
+    }
+
+    TRaisimSceneFile::TRaisimSceneFile()
+    {
+        m_NumBodies = 0;
+        m_RecordsRef = nullptr;
+        m_PayloadRef = nullptr;
+    }
+
+    TRaisimSceneFile::~TRaisimSceneFile()
+    {
+        m_RecordsRef = nullptr;
+        m_PayloadRef = nullptr;
+        m_File.Close();
+    }
+
+    bool TRaisimSceneFile::Save( const std::string& filepath,
+                                 const std::vector<TSingleBody*>& bodies,
+                                 const std::vector<raisim::SingleBodyObject*>& raisim_bodies )
+    {
+        LOCO_CORE_ASSERT( bodies.size() == raisim_bodies.size(), "TRaisimSceneFile::Save >>> expected a raisim \
+                          object for each single-body, but got {0} bodies and {1} objects", bodies.size(), raisim_bodies.size() );
+
+        std::vector<TRaisimSceneBodyRecord> records;
+        std::vector<uint8_t> payload;
+        for ( ssize_t i = 0; i < bodies.size(); i++ )
+        {
+            auto body = bodies[i];
+            auto raisim_body = raisim_bodies[i];
+            if ( !body || !raisim_body )
+                continue;
+
+            auto record = TRaisimSceneBodyRecord();
+            std::memset( &record, 0, sizeof( record ) );
+            const auto& shape_data = body->data().collision;
+            record.name_offset = payload.size();
+            record.name_length = body->name().size();
+            payload.insert( payload.end(), body->name().begin(), body->name().end() );
+            record.shape_type = (int32_t)shape_data.type;
+            record.dyntype = (int32_t)body->dyntype();
+            record.source_hash = ComputeSceneBodyHash( shape_data, body->data().inertia );
+            for ( ssize_t j = 0; j < 3; j++ )
+                record.size[j] = shape_data.size[j];
+
+            // Mass-properties as resolved by raisim (planes and hfields have none)
+            if ( shape_data.type != eShapeType::PLANE && shape_data.type != eShapeType::HFIELD )
+            {
+                record.mass = raisim_body->getMass( 0 );
+                const auto& inertia = raisim_body->getInertiaMatrix_B();
+                for ( ssize_t r = 0; r < 3; r++ )
+                    for ( ssize_t c = 0; c < 3; c++ )
+                        record.inertia[3 * r + c] = inertia( r, c );
+            }
+
+            const auto position = vec3_to_eigen( TVec3( body->tf0().col( 3 ) ) );
+            const auto rotation = mat3_to_eigen( TMat3( body->tf0() ) );
+            const auto linear_vel = vec3_to_eigen( body->linear_vel0() );
+            const auto angular_vel = vec3_to_eigen( body->angular_vel0() );
+            for ( ssize_t r = 0; r < 3; r++ )
+            {
+                record.position[r] = position[r];
+                record.linear_vel[r] = linear_vel[r];
+                record.angular_vel[r] = angular_vel[r];
+                for ( ssize_t c = 0; c < 3; c++ )
+                    record.rotation[3 * r + c] = rotation( r, c );
+            }
+
+            // Heightmaps are stored with their final (already rescaled) heights
+            if ( shape_data.type == eShapeType::HFIELD )
+            {
+                auto raisim_hmap = static_cast<raisim::HeightMap*>( raisim_body );
+                auto& heights = raisim_hmap->getHeightMap();
+                record.hfield_num_x = raisim_hmap->getXSamples();
+                record.hfield_num_y = raisim_hmap->getYSamples();
+                record.hfield_size_x = raisim_hmap->getXSize();
+                record.hfield_size_y = raisim_hmap->getYSize();
+                record.hfield_center_x = raisim_hmap->getCenterX();
+                record.hfield_center_y = raisim_hmap->getCenterY();
+                payload.resize( AlignOffset( payload.size() ), 0 );
+                record.heights_offset = payload.size();
+                const auto heights_bytes = reinterpret_cast<const uint8_t*>( heights.data() );
+                payload.insert( payload.end(), heights_bytes, heights_bytes + heights.size() * sizeof( double ) );
+            }
+            records.push_back( record );
+        }
+
+        auto header = TRaisimSceneFileHeader();
+        std::memset( &header, 0, sizeof( header ) );
+        std::memcpy( header.magic, RAISIM_SCENE_FILE_MAGIC, sizeof( header.magic ) );
+        header.version = RAISIM_SCENE_FILE_VERSION;
+        header.num_bodies = records.size();
+        header.records_offset = AlignOffset( sizeof( header ) );
+        header.payload_offset = AlignOffset( header.records_offset + records.size() * sizeof( TRaisimSceneBodyRecord ) );
+        header.file_size = header.payload_offset + payload.size();
+
+        std::ofstream file( filepath, std::ios::binary | std::ios::trunc );
+        if ( !file.is_open() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSceneFile::Save >>> couldn't open file {0} for writing", filepath );
+            return false;
+        }
+        const std::vector<char> padding( 8, 0 );
+        file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+        file.write( padding.data(), header.records_offset - sizeof( header ) );
+        file.write( reinterpret_cast<const char*>( records.data() ), records.size() * sizeof( TRaisimSceneBodyRecord ) );
+        file.write( padding.data(), header.payload_offset - ( header.records_offset + records.size() * sizeof( TRaisimSceneBodyRecord ) ) );
+        file.write( reinterpret_cast<const char*>( payload.data() ), payload.size() );
+        return file.good();
+    }
+
+    bool TRaisimSceneFile::Open( const std::string& filepath )
+    {
+        m_RecordsRef = nullptr;
+        m_PayloadRef = nullptr;
+        m_NumBodies = 0;
+        m_RecordsMap.clear();
+        if ( !m_File.Open( filepath ) )
+            return false;
+
+        const auto header = reinterpret_cast<const TRaisimSceneFileHeader*>( m_File.data() );
+        if ( m_File.size() < sizeof( TRaisimSceneFileHeader ) ||
+             std::memcmp( header->magic, RAISIM_SCENE_FILE_MAGIC, sizeof( header->magic ) ) != 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSceneFile::Open >>> file {0} isn't a precompiled scene", filepath );
+            m_File.Close();
+            return false;
+        }
+        if ( header->version != RAISIM_SCENE_FILE_VERSION )
+        {
+            LOCO_CORE_ERROR( "TRaisimSceneFile::Open >>> file {0} has version {1}, but version {2} is required \
+                              (recompile the scene)", filepath, header->version, RAISIM_SCENE_FILE_VERSION );
+            m_File.Close();
+            return false;
+        }
+        // Offsets are checked against sizes (not added up), so corrupted values can't overflow past the checks
+        if ( header->file_size != m_File.size() || header->payload_offset > header->file_size ||
+             header->records_offset > header->payload_offset || header->records_offset % 8 != 0 ||
+             header->num_bodies > ( header->payload_offset - header->records_offset ) / sizeof( TRaisimSceneBodyRecord ) )
+        {
+            LOCO_CORE_ERROR( "TRaisimSceneFile::Open >>> file {0} is truncated or corrupted", filepath );
+            m_File.Close();
+            return false;
+        }
+
+        const auto records = reinterpret_cast<const TRaisimSceneBodyRecord*>( m_File.data() + header->records_offset );
+        const uint64_t payload_size = header->file_size - header->payload_offset;
+        for ( ssize_t i = 0; i < header->num_bodies; i++ )
+        {
+            const auto& record = records[i];
+            bool valid = ( record.name_offset <= payload_size && record.name_length <= payload_size - record.name_offset );
+            if ( valid && record.shape_type == (int32_t)eShapeType::HFIELD )
+            {
+                const uint64_t max_num_heights = ( payload_size - std::min( record.heights_offset, payload_size ) ) / sizeof( double );
+                valid = ( record.heights_offset <= payload_size && record.heights_offset % 8 == 0 &&
+                          ( record.hfield_num_x == 0 || record.hfield_num_y <= max_num_heights / record.hfield_num_x ) );
+            }
+            if ( !valid )
+            {
+                LOCO_CORE_ERROR( "TRaisimSceneFile::Open >>> file {0} is corrupted (record {1} points outside of \
+                                  the file)", filepath, i );
+                m_File.Close();
+                return false;
+            }
+        }
+
+        m_NumBodies = header->num_bodies;
+        m_RecordsRef = records;
+        m_PayloadRef = m_File.data() + header->payload_offset;
+        for ( ssize_t i = 0; i < m_NumBodies; i++ )
+        {
+            const auto name = reinterpret_cast<const char*>( m_PayloadRef + m_RecordsRef[i].name_offset );
+            m_RecordsMap[std::string( name, m_RecordsRef[i].name_length )] = i;
+        }
+        return true;
+    }
+
+    const TRaisimSceneBodyRecord* TRaisimSceneFile::FindBody( const std::string& body_name ) const
+    {
+        auto it_record = m_RecordsMap.find( body_name );
+        return ( it_record != m_RecordsMap.end() ) ? &m_RecordsRef[it_record->second] : nullptr;
+    }
+
+    raisim::SingleBodyObject* TRaisimSceneFile::CreateBody( raisim::World* raisim_world,
+                                                            const TRaisimSceneBodyRecord& record,
+                                                            const TShapeData& shape_data,
+                                                            const TInertialData& inertia_data ) const
+    {
+        if ( record.shape_type != (int32_t)shape_data.type || record.source_hash != ComputeSceneBodyHash( shape_data, inertia_data ) )
+        {
+            LOCO_CORE_TRACE( "TRaisimSceneFile::CreateBody >>> record in {0} is out of date w.r.t. the scenario, \
+                              building the body from its collider data instead", filepath() );
+            return nullptr;
+        }
+
+        raisim::Mat<3, 3> inertia;
+        for ( ssize_t r = 0; r < 3; r++ )
+            for ( ssize_t c = 0; c < 3; c++ )
+                inertia( r, c ) = record.inertia[3 * r + c];
+
+        raisim::SingleBodyObject* raisim_body = nullptr;
+        switch ( shape_data.type )
+        {
+            case eShapeType::BOX : raisim_body = raisim_world->addBox( record.size[0], record.size[1], record.size[2], record.mass ); break;
+            case eShapeType::PLANE : raisim_body = raisim_world->addGround(); break;
+            case eShapeType::SPHERE : raisim_body = raisim_world->addSphere( record.size[0], record.mass ); break;
+            case eShapeType::CYLINDER : raisim_body = raisim_world->addCylinder( record.size[0], record.size[1], record.mass ); break;
+            case eShapeType::CAPSULE : raisim_body = raisim_world->addCapsule( record.size[0], record.size[1], record.mass ); break;
+            case eShapeType::ELLIPSOID : raisim_body = CreateEllipsoid( raisim_world, shape_data.size, record.mass, inertia ); break;
+            case eShapeType::MESH : raisim_body = CreateMesh( raisim_world, shape_data.size, shape_data.mesh_data, record.mass, inertia ); break;
+            case eShapeType::HFIELD :
+            {
+                // Raisim only takes the heights as a vector (which it then copies into its own storage), so they go
+                // through a transient copy out of the mapping, freed once the heightmap is created
+                const auto heights_begin = reinterpret_cast<const double*>( m_PayloadRef + record.heights_offset );
+                const std::vector<double> heights( heights_begin, heights_begin + record.hfield_num_x * record.hfield_num_y );
+                raisim_body = raisim_world->addHeightMap( record.hfield_num_x, record.hfield_num_y, record.hfield_size_x,
+                                                          record.hfield_size_y, record.hfield_center_x, record.hfield_center_y, heights );
+                break;
+            }
+        }
+        if ( !raisim_body )
+            return nullptr;
+
+        Eigen::Matrix3d rotation;
+        for ( ssize_t r = 0; r < 3; r++ )
+            for ( ssize_t c = 0; c < 3; c++ )
+                rotation( r, c ) = record.rotation[3 * r + c];
+        raisim_body->setBodyType( record.dyntype == (int32_t)eDynamicsType::DYNAMIC ? raisim::BodyType::DYNAMIC : raisim::BodyType::STATIC );
+        raisim_body->setPose( Eigen::Vector3d( record.position[0], record.position[1], record.position[2] ), rotation );
+        if ( record.dyntype == (int32_t)eDynamicsType::DYNAMIC )
+            raisim_body->setVelocity( Eigen::Vector3d( record.linear_vel[0], record.linear_vel[1], record.linear_vel[2] ),
+                                      Eigen::Vector3d( record.angular_vel[0], record.angular_vel[1], record.angular_vel[2] ) );
+        return raisim_body;
+    }
+
+}}
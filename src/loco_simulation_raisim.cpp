@@ -1,40 +1,60 @@
 
 #include <loco_simulation_raisim.h>
+#include <loco_allocs_raisim.h>
+#include <loco_trace_raisim.h>
+#include <compounds/loco_compound.h>
+#include <kinematic_trees/loco_kinematic_tree.h>
+
+#include <fstream>
 
 namespace loco {
 namespace raisimlib {
 
-    TRaisimSimulation::TRaisimSimulation( TScenario* scenarioRef )
+    TRaisimSimulation::TRaisimSimulation( TScenario* scenarioRef, bool batch_single_bodies, bool merge_static_bodies )
         : TISimulation( scenarioRef )
     {
         m_backendId = "RAISIM";
+        m_BatchSingleBodies = batch_single_bodies;
+        m_MergeStaticBodies = merge_static_bodies;
 
+        m_MaxNumLinks = 0;
+        m_ReplayFrame = 0;
+        m_TimingSyncNs = 0;
         m_RaisimWorld = std::make_unique<raisim::World>(); m_RaisimWorld->setTimeStep( 0.002 );
         m_RaisimWorld->setGravity( vec3_to_raisim( { 0, 0, -9.81 } ) );
+        m_SingleBodyBatch.SetRaisimWorld( m_RaisimWorld.get() );
+        m_BodyPool.SetRaisimWorld( m_RaisimWorld.get() );
+        m_StaticMerger.SetRaisimWorld( m_RaisimWorld.get() );
+
+        // Place all adapters of this world in a single arena, sized from the scenario up-front
+        const size_t num_single_bodies = m_scenarioRef->GetSingleBodiesList().size();
+        m_Arena.Reserve( TRaisimArena::RequiredBytes<TRaisimSingleBodyAdapter>( num_single_bodies ) +
+                         TRaisimArena::RequiredBytes<TRaisimSingleBodyColliderAdapter>( num_single_bodies ) +
+                         TRaisimArena::RequiredBytes<TRaisimCompoundAdapter>( m_scenarioRef->GetCompoundsList().size() ) +
+                         TRaisimArena::RequiredBytes<TRaisimKinematicTreeAdapter>( m_scenarioRef->GetKinematicTreesList().size() ) );
 
         _CollectSingleBodyAdapters();
-        //// _CollectCompoundAdapters();
-        //// _CollectKintreeAdapters();
+        _CollectCompoundAdapters();
+        _CollectKintreeAdapters();
         //// _CollectTerrainGeneratorsAdapters();
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Created TRaisimSimulation @ {0}", loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Created TRaisimSimulation @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        LOCO_RAISIM_TRACK_CREATED( SIMULATION );
     }
 
     TRaisimSimulation::~TRaisimSimulation()
     {
+        // The recorder reads from the raisim objects up to the last frame, so finish it before they're gone
+        m_Recorder = nullptr;
         m_RaisimWorld = nullptr;
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Destroyec TRaisimSimulation @ {0}", loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Destroyec TRaisimSimulation @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        // Adapters live in the arena, so destroy them before it goes away (including the ones owned by the base)
+        m_CompoundAdapters.clear();
+        m_KintreeAdapters.clear();
+        m_BackendSingleBodyAdapters.clear();
+        m_singleBodyAdapters.clear();
+        m_collisionAdapters.clear();
+
+        LOCO_RAISIM_TRACK_DESTROYED( SIMULATION );
     }
 
     void TRaisimSimulation::_CollectSingleBodyAdapters()
@@ -42,27 +62,107 @@ namespace raisimlib {
         auto single_bodies = m_scenarioRef->GetSingleBodiesList();
         for ( auto single_body : single_bodies )
         {
-            auto single_body_adapter = std::make_unique<TRaisimSingleBodyAdapter>( single_body );
-            single_body_adapter->SetRaisimWorld( m_RaisimWorld.get() );
-            single_body->SetBodyAdapter( single_body_adapter.get() );
-            m_singleBodyAdapters.push_back( std::move( single_body_adapter ) );
-
             auto collider = single_body->collider();
             LOCO_CORE_ASSERT( collider, "TRaisimSimulation::_CollectSingleBodyAdapters >>> single-body {0} \
                               doesn't have an associated collider", single_body->name() );
 
-            auto collider_adapter = std::make_unique<TRaisimSingleBodyColliderAdapter>( collider );
+            // Merged bodies have no raisim object of their own (just a shape in a static compound), so they get no
+            // adapters at all, and the loco-side calls on them never reach the backend
+            if ( m_MergeStaticBodies && TRaisimStaticMerger::CanMerge( single_body ) )
+            {
+                m_StaticMerger.Add( single_body );
+                continue;
+            }
+
+            auto single_body_adapter = std::unique_ptr<TRaisimSingleBodyAdapter>( new ( m_Arena ) TRaisimSingleBodyAdapter( single_body ) );
+            single_body_adapter->SetRaisimWorld( m_RaisimWorld.get() );
+            single_body->SetBodyAdapter( single_body_adapter.get() );
+            m_SingleBodyAdaptersMap[single_body->name()] = single_body_adapter.get();
+
+            auto collider_adapter = std::unique_ptr<TRaisimSingleBodyColliderAdapter>( new ( m_Arena ) TRaisimSingleBodyColliderAdapter( collider ) );
             collider_adapter->SetRaisimWorld( m_RaisimWorld.get() );
             collider->SetColliderAdapter( collider_adapter.get() );
+
+            if ( m_BatchSingleBodies )
+            {
+                m_SingleBodyBatch.Add( single_body, collider_adapter.get() );
+                m_BackendSingleBodyAdapters.push_back( std::move( single_body_adapter ) );
+            }
+            else
+            {
+                m_singleBodyAdapters.push_back( std::move( single_body_adapter ) );
+            }
             m_collisionAdapters.push_back( std::move( collider_adapter ) );
         }
     }
 
+    void TRaisimSimulation::_CollectCompoundAdapters()
+    {
+        auto compounds = m_scenarioRef->GetCompoundsList();
+        for ( auto compound : compounds )
+        {
+            auto compound_adapter = std::unique_ptr<TRaisimCompoundAdapter>( new ( m_Arena ) TRaisimCompoundAdapter( compound ) );
+            compound_adapter->SetRaisimWorld( m_RaisimWorld.get() );
+            m_CompoundAdaptersMap[compound->name()] = compound_adapter.get();
+            m_CompoundAdapters.push_back( std::move( compound_adapter ) );
+        }
+    }
+
+    void TRaisimSimulation::_CollectKintreeAdapters()
+    {
+        auto kintrees = m_scenarioRef->GetKinematicTreesList();
+        for ( auto kintree : kintrees )
+        {
+            auto kintree_adapter = std::unique_ptr<TRaisimKinematicTreeAdapter>( new ( m_Arena ) TRaisimKinematicTreeAdapter( kintree ) );
+            kintree_adapter->SetRaisimWorld( m_RaisimWorld.get() );
+            m_KintreeAdaptersMap[kintree->name()] = kintree_adapter.get();
+            m_KintreeAdapters.push_back( std::move( kintree_adapter ) );
+        }
+    }
+
     bool TRaisimSimulation::_InitializeInternal()
     {
         // Collect raisim-resources from the adapters and assemble any required resources
         // @todo: implement-me ...
 
+        LOCO_RAISIM_TRACE_SCOPE( "initialize", m_RaisimWorld.get() );
+        // Batched|merged single-bodies aren't handled by the base, so build|initialize them here (in one go)
+        if ( m_BatchSingleBodies )
+        {
+            m_SingleBodyBatch.Build();
+            m_SingleBodyBatch.Initialize();
+            for ( ssize_t i = 0; i < m_SingleBodyBatch.num_bodies(); i++ )
+                m_SingleBodyAdaptersMap[m_SingleBodyBatch.body( i )->name()]->SetRaisimBody( m_SingleBodyBatch.raisim_body( i ) );
+        }
+        if ( m_MergeStaticBodies && m_StaticMerger.num_bodies() > 0 )
+            m_StaticMerger.Build();
+        // Compound and kintree adapters are owned by the backend, so build|initialize them here
+        for ( auto& compound_adapter : m_CompoundAdapters )
+        {
+            compound_adapter->Build();
+            compound_adapter->Initialize();
+        }
+        for ( auto& kintree_adapter : m_KintreeAdapters )
+        {
+            kintree_adapter->Build();
+            if ( !kintree_adapter->raisim_articulated_system() )
+                continue;
+            kintree_adapter->Initialize();
+            m_MaxNumLinks = std::max( m_MaxNumLinks, kintree_adapter->num_links() );
+        }
+        // Drop kintrees that couldn't be built, so every other query can assume an articulated-system is available
+        for ( auto it_adapter = m_KintreeAdapters.begin(); it_adapter != m_KintreeAdapters.end(); )
+        {
+            if ( ( *it_adapter )->raisim_articulated_system() )
+            {
+                it_adapter++;
+                continue;
+            }
+            m_KintreeAdaptersMap.erase( ( *it_adapter )->kintree()->name() );
+            it_adapter = m_KintreeAdapters.erase( it_adapter );
+        }
+        m_JointController.Initialize( kintree_adapters() );
+
         LOCO_CORE_TRACE( "Raisim-backend >>> gravity    : {0}", ToString( vec3_from_eigen( m_RaisimWorld->getGravity().e() ) ) );
         LOCO_CORE_TRACE( "Raisim-backend >>> time-step  : {0}", std::to_string( m_RaisimWorld->getTimeStep() ) );
         LOCO_CORE_TRACE( "Raisim-backend >>> num-objs   : {0}", std::to_string( m_RaisimWorld->getObjList().size() ) );
@@ -72,25 +172,517 @@ namespace raisimlib {
 
     void TRaisimSimulation::_PreStepInternal()
     {
-        // Do nothing here, as call to wrappers is enough (made in base)
+        // Do nothing here, as call to wrappers is enough (made in base). Only marks the start of the step, so the
+        // time the base spends between the backend phases is accounted as sync
+        m_TimingSyncNs = 0;
+        _TimingEndPhase();
     }
 
     void TRaisimSimulation::_SimStepInternal()
     {
-        const double target_steptime = 1.0 / 60.0;
-        const double sim_start = m_RaisimWorld->getWorldTime();
-        while ( m_RaisimWorld->getWorldTime() - sim_start < target_steptime )
-            m_RaisimWorld->integrate();
+        _TimingBeginPhase();
+        {
+            LOCO_RAISIM_PROFILE_SCOPE( m_TimingSimStep );
+            LOCO_RAISIM_TRACE_SCOPE( "sim_step", m_RaisimWorld.get() );
+            if ( m_Replayer )
+            {
+                // Recordings hold one frame per step, so just move to the next one (holding the last one at the end)
+                m_ReplayFrame = std::min<ssize_t>( m_ReplayFrame + 1, m_Replayer->num_frames() - 1 );
+                m_Replayer->ApplyFrame( m_ReplayFrame );
+                _TimingEndPhase();
+                return;
+            }
+            const double target_steptime = 1.0 / 60.0;
+            const double sim_start = m_RaisimWorld->getWorldTime();
+            while ( m_RaisimWorld->getWorldTime() - sim_start < target_steptime )
+            {
+                LOCO_RAISIM_TRACE_SCOPE( "substep", m_RaisimWorld.get() );
+                m_RaisimWorld->integrate();
+            }
+        }
+        _TimingEndPhase();
     }
 
     void TRaisimSimulation::_PostStepInternal()
     {
-        // @todo: run loco-contact-manager here to grab all detected contacts
+        _TimingBeginPhase();
+        {
+            LOCO_RAISIM_PROFILE_SCOPE( m_TimingPostStep );
+            LOCO_RAISIM_TRACE_SCOPE( "post_step", m_RaisimWorld.get() );
+            // @todo: run loco-contact-manager here to grab all detected contacts
+            m_ContactSensors.Update( m_RaisimWorld->getTimeStep() );
+            if ( m_Recorder )
+                m_Recorder->Record( m_RaisimWorld->getWorldTime() );
+        }
+        _TimingEndPhase();
+        {
+            // Writing the raisim state back into the loco compounds|kintrees is part of the scenario sync
+            LOCO_RAISIM_TRACE_SCOPE( "sync", m_RaisimWorld.get() );
+            for ( auto& compound_adapter : m_CompoundAdapters )
+                compound_adapter->PostStep();
+            for ( auto& kintree_adapter : m_KintreeAdapters )
+                kintree_adapter->PostStep();
+        }
+        _TimingBeginPhase();
+    #if defined( LOCO_RAISIM_USE_PROFILING )
+        m_TimingSync.AddSample( m_TimingSyncNs );
+    #endif
+    }
+
+    void TRaisimSimulation::_TimingBeginPhase()
+    {
+    #if defined( LOCO_RAISIM_USE_PROFILING )
+        const auto elapsed = std::chrono::steady_clock::now() - m_TimingPhaseEnd;
+        m_TimingSyncNs += std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count();
+    #endif
+    }
+
+    void TRaisimSimulation::_TimingEndPhase()
+    {
+    #if defined( LOCO_RAISIM_USE_PROFILING )
+        m_TimingPhaseEnd = std::chrono::steady_clock::now();
+    #endif
+    }
+
+    TRaisimStepStats TRaisimSimulation::step_stats() const
+    {
+        auto stats = TRaisimStepStats();
+        stats.sim_step = m_TimingSimStep.stats();
+        stats.post_step = m_TimingPostStep.stats();
+        stats.sync = m_TimingSync.stats();
+        return stats;
+    }
+
+    void TRaisimSimulation::ResetStepStats()
+    {
+        m_TimingSimStep.Reset();
+        m_TimingPostStep.Reset();
+        m_TimingSync.Reset();
     }
 
     void TRaisimSimulation::_ResetInternal()
     {
+        LOCO_RAISIM_TRACE_SCOPE( "reset", m_RaisimWorld.get() );
         // @todo: reset loco-contact-manager
+        m_ContactSensors.Reset();
+
+        if ( m_BatchSingleBodies )
+            m_SingleBodyBatch.Reset();
+        m_BodyPool.DespawnAll();
+        for ( auto& compound_adapter : m_CompoundAdapters )
+            compound_adapter->Reset();
+        for ( auto& kintree_adapter : m_KintreeAdapters )
+            kintree_adapter->Reset();
+    }
+
+    bool TRaisimSimulation::SavePrecompiledScene( const std::string& filepath )
+    {
+        std::vector<TSingleBody*> bodies;
+        std::vector<raisim::SingleBodyObject*> raisim_bodies;
+        for ( auto single_body : m_scenarioRef->GetSingleBodiesList() )
+        {
+            auto it_adapter = m_SingleBodyAdaptersMap.find( single_body->name() );
+            if ( it_adapter == m_SingleBodyAdaptersMap.end() || !it_adapter->second->raisim_body() )
+                continue;
+            bodies.push_back( single_body );
+            raisim_bodies.push_back( it_adapter->second->raisim_body() );
+        }
+        if ( bodies.size() < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::SavePrecompiledScene >>> there are no built single-bodies to save \
+                              (simulation must be initialized first)" );
+            return false;
+        }
+        return TRaisimSceneFile::Save( filepath, bodies, raisim_bodies );
+    }
+
+    bool TRaisimSimulation::LoadPrecompiledScene( const std::string& filepath )
+    {
+        auto scene_file = std::make_unique<TRaisimSceneFile>();
+        if ( !scene_file->Open( filepath ) )
+            return false;
+
+        m_SceneFile = std::move( scene_file );
+        m_SingleBodyBatch.SetSceneFile( m_SceneFile.get() );
+        for ( auto single_body_adapter : single_body_adapters() )
+            single_body_adapter->SetSceneFile( m_SceneFile.get() );
+        return true;
+    }
+
+    bool TRaisimSimulation::SetHfieldFileSource( const std::string& body_name, const TRaisimHfieldFileSource& source )
+    {
+        auto single_body_adapter = GetSingleBodyAdapterByName( body_name );
+        if ( !single_body_adapter )
+            return false;
+        if ( single_body_adapter->raisim_body() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::SetHfieldFileSource >>> single-body {0} was already built (the source \
+                              must be set before initializing)", body_name );
+            return false;
+        }
+
+        auto& hfield_source = m_HfieldSources[body_name];
+        hfield_source = std::make_unique<TRaisimHfieldFileSource>( source );
+        single_body_adapter->SetHfieldSource( hfield_source.get() );
+        for ( ssize_t i = 0; i < m_SingleBodyBatch.num_bodies(); i++ )
+            if ( m_SingleBodyBatch.body( i )->name() == body_name )
+                m_SingleBodyBatch.SetHfieldSource( i, hfield_source.get() );
+        return true;
+    }
+
+    bool TRaisimSimulation::ReservePooledBodies( const TShapeData& shape_data, const TInertialData& inertia_data, ssize_t num_bodies )
+    {
+        return m_BodyPool.Reserve( shape_data, inertia_data, num_bodies );
+    }
+
+    ssize_t TRaisimSimulation::SpawnBody( const TShapeData& shape_data,
+                                          const TInertialData& inertia_data,
+                                          const TMat4& transform,
+                                          const TVec3& linear_vel,
+                                          const TVec3& angular_vel )
+    {
+        const ssize_t handle = m_BodyPool.Spawn( shape_data, inertia_data, transform, linear_vel, angular_vel );
+        if ( handle < 0 )
+            LOCO_CORE_WARN( "TRaisimSimulation::SpawnBody >>> couldn't spawn a body with shape {0} (pool exhausted \
+                             or not reserved)", ToString( shape_data.type ) );
+        return handle;
+    }
+
+    bool TRaisimSimulation::DespawnBody( ssize_t handle )
+    {
+        return m_BodyPool.Despawn( handle );
+    }
+
+    raisim::Compound* TRaisimSimulation::GetMergedStaticCompound( const std::string& body_name, ssize_t* dst_child_index )
+    {
+        const ssize_t index = m_StaticMerger.FindBody( body_name );
+        if ( index < 0 )
+            return nullptr;
+        if ( dst_child_index )
+            *dst_child_index = m_StaticMerger.child_index( index );
+        return m_StaticMerger.raisim_compound( index );
+    }
+
+    bool TRaisimSimulation::StartRecording( const std::string& filepath, bool record_contacts,
+                                            const TRaisimRecordingCompression& compression,
+                                            ssize_t ring_frames, size_t chunk_bytes )
+    {
+        StopRecording();
+
+        std::vector<std::pair<std::string, raisim::SingleBodyObject*>> bodies;
+        for ( auto single_body : m_scenarioRef->GetSingleBodiesList() )
+        {
+            if ( single_body->dyntype() != eDynamicsType::DYNAMIC )
+                continue;
+            auto it_adapter = m_SingleBodyAdaptersMap.find( single_body->name() );
+            if ( it_adapter != m_SingleBodyAdaptersMap.end() && it_adapter->second->raisim_body() )
+                bodies.push_back( { single_body->name(), it_adapter->second->raisim_body() } );
+        }
+        std::vector<std::pair<std::string, raisim::ArticulatedSystem*>> kintrees;
+        for ( auto& kintree_adapter : m_KintreeAdapters )
+            if ( kintree_adapter->raisim_articulated_system() )
+                kintrees.push_back( { kintree_adapter->kintree()->name(), kintree_adapter->raisim_articulated_system() } );
+        if ( bodies.size() + kintrees.size() < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::StartRecording >>> there are no built bodies to record \
+                              (simulation must be initialized first)" );
+            return false;
+        }
+
+        m_Recorder = std::make_unique<TRaisimTrajectoryRecorder>( bodies, kintrees, record_contacts ? &m_ContactSensors : nullptr,
+                                                                  m_RaisimWorld->getTimeStep() );
+        return m_Recorder->Start( filepath, ring_frames, chunk_bytes, compression );
+    }
+
+    bool TRaisimSimulation::StopRecording()
+    {
+        return m_Recorder ? m_Recorder->Stop() : false;
+    }
+
+    bool TRaisimSimulation::StartReplay( const std::string& filepath )
+    {
+        StopReplay();
+
+        auto replayer = std::make_unique<TRaisimTrajectoryReplayer>();
+        if ( !replayer->Open( filepath ) )
+            return false;
+        if ( replayer->num_frames() < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::StartReplay >>> recording {0} has no frames to replay", filepath );
+            return false;
+        }
+
+        ssize_t num_bound = 0;
+        for ( const auto& body_name : replayer->body_names() )
+        {
+            auto it_adapter = m_SingleBodyAdaptersMap.find( body_name );
+            if ( it_adapter != m_SingleBodyAdaptersMap.end() && it_adapter->second->raisim_body() )
+                num_bound += replayer->BindBody( body_name, it_adapter->second->raisim_body() ) ? 1 : 0;
+        }
+        for ( const auto& kintree_name : replayer->kintree_names() )
+        {
+            auto it_adapter = m_KintreeAdaptersMap.find( kintree_name );
+            if ( it_adapter != m_KintreeAdaptersMap.end() && it_adapter->second->raisim_articulated_system() )
+                num_bound += replayer->BindKintree( kintree_name, it_adapter->second->raisim_articulated_system() ) ? 1 : 0;
+        }
+        if ( num_bound < 1 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::StartReplay >>> none of the bodies in recording {0} are in this \
+                              simulation (it must be initialized first)", filepath );
+            return false;
+        }
+        if ( num_bound < replayer->num_bodies() + replayer->num_kintrees() )
+            LOCO_CORE_WARN( "TRaisimSimulation::StartReplay >>> only {0} of the {1} recorded bodies will be replayed",
+                            num_bound, replayer->num_bodies() + replayer->num_kintrees() );
+
+        m_Replayer = std::move( replayer );
+        m_ReplayFrame = 0;
+        m_Replayer->ApplyFrame( m_ReplayFrame );
+        return true;
+    }
+
+    bool TRaisimSimulation::SeekReplay( ssize_t frame_index )
+    {
+        if ( !m_Replayer || frame_index < 0 || frame_index >= m_Replayer->num_frames() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::SeekReplay >>> can't seek to frame {0} (not replaying, or frame \
+                              out of range)", frame_index );
+            return false;
+        }
+        m_ReplayFrame = frame_index;
+        m_Replayer->ApplyFrame( m_ReplayFrame );
+        return true;
+    }
+
+    void TRaisimSimulation::StopReplay()
+    {
+        m_Replayer = nullptr;
+        m_ReplayFrame = 0;
+    }
+
+    TRaisimSingleBodyAdapter* TRaisimSimulation::GetSingleBodyAdapterByName( const std::string& body_name )
+    {
+        auto it_adapter = m_SingleBodyAdaptersMap.find( body_name );
+        if ( it_adapter == m_SingleBodyAdaptersMap.end() )
+        {
+            if ( m_StaticMerger.FindBody( body_name ) >= 0 )
+                LOCO_CORE_ERROR( "TRaisimSimulation::GetSingleBodyAdapterByName >>> single-body {0} was merged into a \
+                                  static compound, so it has no adapter (use GetMergedStaticCompound)", body_name );
+            else
+                LOCO_CORE_ERROR( "TRaisimSimulation::GetSingleBodyAdapterByName >>> there's no single-body named {0}", body_name );
+            return nullptr;
+        }
+        return it_adapter->second;
+    }
+
+    TRaisimCompoundAdapter* TRaisimSimulation::GetCompoundAdapterByName( const std::string& compound_name )
+    {
+        auto it_adapter = m_CompoundAdaptersMap.find( compound_name );
+        if ( it_adapter == m_CompoundAdaptersMap.end() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::GetCompoundAdapterByName >>> there's no compound named {0}", compound_name );
+            return nullptr;
+        }
+        return it_adapter->second;
+    }
+
+    bool TRaisimSimulation::SetKintreeModelFile( const std::string& kintree_name, const std::string& model_filepath )
+    {
+        auto kintree_adapter = GetKintreeAdapterByName( kintree_name );
+        if ( !kintree_adapter )
+            return false;
+        if ( kintree_adapter->raisim_articulated_system() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::SetKintreeModelFile >>> kintree {0} was already built (the model file \
+                              must be set before initializing)", kintree_name );
+            return false;
+        }
+        kintree_adapter->SetModelFilepath( model_filepath );
+        return true;
+    }
+
+    TRaisimKinematicTreeAdapter* TRaisimSimulation::GetKintreeAdapterByName( const std::string& kintree_name )
+    {
+        auto it_adapter = m_KintreeAdaptersMap.find( kintree_name );
+        if ( it_adapter == m_KintreeAdaptersMap.end() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::GetKintreeAdapterByName >>> there's no kintree named {0}", kintree_name );
+            return nullptr;
+        }
+        return it_adapter->second;
+    }
+
+    void TRaisimSimulation::GetKintreesLinkFrames( double* dst_frames, double* dst_velocities ) const
+    {
+        for ( ssize_t i = 0; i < m_KintreeAdapters.size(); i++ )
+        {
+            const ssize_t num_links = m_KintreeAdapters[i]->num_links();
+            double* dst_kintree_frames = dst_frames + 7 * m_MaxNumLinks * i;
+            double* dst_kintree_velocities = ( dst_velocities ) ? dst_velocities + 6 * m_MaxNumLinks * i : nullptr;
+            m_KintreeAdapters[i]->GetLinkFrames( dst_kintree_frames, dst_kintree_velocities );
+
+            std::fill( dst_kintree_frames + 7 * num_links, dst_kintree_frames + 7 * m_MaxNumLinks, 0.0 );
+            if ( dst_kintree_velocities )
+                std::fill( dst_kintree_velocities + 6 * num_links, dst_kintree_velocities + 6 * m_MaxNumLinks, 0.0 );
+        }
+    }
+
+    std::unique_ptr<TRaisimKintreesDynamicsQuery> TRaisimSimulation::CreateKintreesDynamicsQuery( const std::vector<std::string>& kintree_names,
+                                                                                                 const std::vector<std::string>& frame_names )
+    {
+        std::vector<TRaisimKinematicTreeAdapter*> kintree_adapters_refs;
+        if ( kintree_names.size() < 1 )
+            kintree_adapters_refs = kintree_adapters();
+        for ( const auto& kintree_name : kintree_names )
+            if ( auto kintree_adapter = GetKintreeAdapterByName( kintree_name ) )
+                kintree_adapters_refs.push_back( kintree_adapter );
+
+        return std::make_unique<TRaisimKintreesDynamicsQuery>( kintree_adapters_refs, frame_names );
+    }
+
+    void TRaisimSimulation::SetNumWorkerThreads( ssize_t num_threads )
+    {
+        m_ThreadPool = std::make_unique<TRaisimThreadPool>( num_threads );
+    }
+
+    TRaisimMemoryReport TRaisimSimulation::GetMemoryReport() const
+    {
+        TRaisimMemoryReport report;
+        report.num_worlds = 1;
+
+        // Names of the assets created through loco, and the extra bytes they account for (e.g. mesh data)
+        std::unordered_map<const raisim::Object*, std::string> assets_names;
+        std::unordered_map<const raisim::Object*, size_t> assets_extra_bytes;
+        for ( const auto& name_adapter : m_SingleBodyAdaptersMap )
+            if ( name_adapter.second->raisim_body() )
+                assets_names[name_adapter.second->raisim_body()] = name_adapter.first;
+        for ( ssize_t i = 0; i < m_StaticMerger.groups().size(); i++ )
+            assets_names[m_StaticMerger.groups()[i].raisim_compound] = "merged_static_" + std::to_string( i );
+        for ( const auto& name_adapter : m_CompoundAdaptersMap )
+            assets_names[name_adapter.second->raisim_compound()] = name_adapter.first;
+        for ( const auto& name_adapter : m_KintreeAdaptersMap )
+            assets_names[name_adapter.second->raisim_articulated_system()] = name_adapter.first;
+        for ( ssize_t handle = 0; handle < m_BodyPool.num_bodies(); handle++ )
+            assets_names[m_BodyPool.raisim_body( handle )] = "pooled_body_" + std::to_string( handle );
+
+        // Raisim keeps its own copy of the mesh data, which is estimated from the user vertex-data or the file size
+        for ( auto single_body : m_scenarioRef->GetSingleBodiesList() )
+        {
+            const auto& collider_data = single_body->collider()->data();
+            // Loco keeps the (single-precision) height samples of heightfields, besides raisim's own copy
+            if ( collider_data.type == eShapeType::HFIELD )
+                report.core_hfield_bytes += collider_data.hfield_data.heights.capacity() * sizeof( float );
+            if ( collider_data.type != eShapeType::MESH )
+                continue;
+            auto it_adapter = m_SingleBodyAdaptersMap.find( single_body->name() );
+            if ( it_adapter == m_SingleBodyAdaptersMap.end() )
+                continue;
+
+            size_t mesh_bytes = collider_data.mesh_data.vertices.size() * sizeof( float ) +
+                                collider_data.mesh_data.faces.size() * sizeof( int );
+            if ( collider_data.mesh_data.filename != "" )
+            {
+                std::ifstream mesh_file( collider_data.mesh_data.filename, std::ios::binary | std::ios::ate );
+                if ( mesh_file.is_open() )
+                    mesh_bytes = std::max( (std::streamoff)0, (std::streamoff)mesh_file.tellg() );
+            }
+            report.estimated_mesh_bytes += mesh_bytes;
+            assets_extra_bytes[it_adapter->second->raisim_body()] += mesh_bytes;
+        }
+
+        auto& raisim_objects = m_RaisimWorld->getObjList();
+        for ( ssize_t i = 0; i < raisim_objects.size(); i++ )
+        {
+            auto raisim_object = raisim_objects[i];
+            const std::string type = ObjectTypeToString( raisim_object->getObjectType() );
+            size_t object_bytes = ObjectStructBytes( raisim_object );
+            size_t asset_bytes = 0;
+
+            // Contact lists are reused across steps, so their capacity is what's resident
+            const auto& contacts = raisim_object->getContacts();
+            const size_t contact_bytes = contacts.capacity() * sizeof( raisim::Contact );
+            report.contact_bytes += contact_bytes;
+            asset_bytes += contact_bytes;
+
+            if ( raisim_object->getObjectType() == raisim::ObjectType::HEIGHTMAP )
+            {
+                auto& heights = static_cast<raisim::HeightMap*>( raisim_object )->getHeightMap();
+                report.hfield_bytes += heights.capacity() * sizeof( double );
+                report.hfield_build_copy_bytes = std::max( report.hfield_build_copy_bytes, heights.size() * sizeof( double ) );
+                asset_bytes += heights.capacity() * sizeof( double );
+            }
+            else if ( raisim_object->getObjectType() == raisim::ObjectType::COMPOUND )
+            {
+                object_bytes += static_cast<raisim::Compound*>( raisim_object )->getObjList().capacity() *
+                                sizeof( raisim::Compound::CompoundObjectChild );
+            }
+            else if ( raisim_object->getObjectType() == raisim::ObjectType::ARTICULATED_SYSTEM )
+            {
+                // Dense joint-space dynamics (mass-matrix and its factorization, plus nonlinear-effects)
+                const size_t num_dofs = static_cast<raisim::ArticulatedSystem*>( raisim_object )->getDOF();
+                const size_t dynamics_bytes = ( 2 * num_dofs * num_dofs + num_dofs ) * sizeof( double );
+                report.estimated_dynamics_bytes += dynamics_bytes;
+                asset_bytes += dynamics_bytes;
+            }
+
+            report.num_objects_per_type[type]++;
+            report.object_bytes_per_type[type] += object_bytes;
+            asset_bytes += object_bytes;
+
+            auto asset = TRaisimAssetMemory();
+            auto it_name = assets_names.find( raisim_object );
+            asset.name = ( it_name != assets_names.end() ) ? it_name->second : "raisim_obj_" + std::to_string( i );
+            asset.type = type;
+            auto it_extra_bytes = assets_extra_bytes.find( raisim_object );
+            asset.bytes = asset_bytes + ( ( it_extra_bytes != assets_extra_bytes.end() ) ? it_extra_bytes->second : 0 );
+            report.assets.push_back( asset );
+        }
+
+        report.adapter_bytes += ( m_singleBodyAdapters.size() + m_BackendSingleBodyAdapters.size() ) * sizeof( TRaisimSingleBodyAdapter );
+        report.adapter_bytes += m_SingleBodyBatch.memory_bytes();
+        report.adapter_bytes += m_collisionAdapters.size() * sizeof( TRaisimSingleBodyColliderAdapter );
+        report.adapter_bytes += m_CompoundAdapters.size() * sizeof( TRaisimCompoundAdapter );
+        for ( const auto& kintree_adapter : m_KintreeAdapters )
+            report.adapter_bytes += kintree_adapter->memory_bytes();
+        report.adapter_bytes += m_ContactSensors.num_sensors() * sizeof( TRaisimContactReading );
+
+        report.SortAssets();
+        return report;
+    }
+
+    std::vector<TRaisimSingleBodyAdapter*> TRaisimSimulation::single_body_adapters()
+    {
+        std::vector<TRaisimSingleBodyAdapter*> single_body_adapters_refs;
+        for ( auto& single_body_adapter : m_singleBodyAdapters )
+            single_body_adapters_refs.push_back( static_cast<TRaisimSingleBodyAdapter*>( single_body_adapter.get() ) );
+        for ( auto& single_body_adapter : m_BackendSingleBodyAdapters )
+            single_body_adapters_refs.push_back( single_body_adapter.get() );
+        return single_body_adapters_refs;
+    }
+
+    std::vector<TRaisimKinematicTreeAdapter*> TRaisimSimulation::kintree_adapters()
+    {
+        std::vector<TRaisimKinematicTreeAdapter*> kintree_adapters_refs;
+        for ( auto& kintree_adapter : m_KintreeAdapters )
+            kintree_adapters_refs.push_back( kintree_adapter.get() );
+        return kintree_adapters_refs;
+    }
+
+    ssize_t TRaisimSimulation::AddContactSensor( const std::string& body_name )
+    {
+        if ( m_StaticMerger.FindBody( body_name ) >= 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::AddContactSensor >>> single-body {0} was merged into a static \
+                              compound, so it can't have its own contact-sensor", body_name );
+            return -1;
+        }
+        auto it_adapter = m_SingleBodyAdaptersMap.find( body_name );
+        if ( it_adapter == m_SingleBodyAdaptersMap.end() )
+        {
+            LOCO_CORE_ERROR( "TRaisimSimulation::AddContactSensor >>> there's no single-body named {0}", body_name );
+            return -1;
+        }
+        return m_ContactSensors.AddSensor( it_adapter->second );
     }
 
     extern "C" TISimulation* simulation_create( TScenario* scenarioRef )
@@ -0,0 +1,128 @@
+#include <loco_trace_raisim.h>
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimTraceRecorder& TRaisimTraceRecorder::GetInstance()
+    {
+        static TRaisimTraceRecorder s_Instance;
+        return s_Instance;
+    }
+
+    TRaisimTraceRecorder::TRaisimTraceRecorder()
+    {
+        m_Enabled = false;
+        m_EventsPerThread = 1 << 16;
+        m_Epoch = std::chrono::steady_clock::now();
+    }
+
+    void TRaisimTraceRecorder::Enable( ssize_t events_per_thread )
+    {
+        {
+            std::lock_guard<std::mutex> lock( m_ThreadBuffersMutex );
+            m_EventsPerThread = 1;
+            while ( m_EventsPerThread < events_per_thread )
+                m_EventsPerThread <<= 1;
+        }
+        m_Enabled.store( true, std::memory_order_relaxed );
+    }
+
+    void TRaisimTraceRecorder::Disable()
+    {
+        m_Enabled.store( false, std::memory_order_relaxed );
+    }
+
+    void TRaisimTraceRecorder::Clear()
+    {
+        std::lock_guard<std::mutex> lock( m_ThreadBuffersMutex );
+        for ( auto& thread_buffer : m_ThreadBuffers )
+            thread_buffer->head.store( 0, std::memory_order_release );
+    }
+
+    void TRaisimTraceRecorder::Record( const char* name, const void* context, int64_t begin_ns, int64_t duration_ns )
+    {
+        auto thread_buffer = _GetThreadBuffer();
+        const uint64_t head = thread_buffer->head.load( std::memory_order_relaxed );
+        auto& event = thread_buffer->events[head & thread_buffer->capacity_mask];
+        event.name = name;
+        event.context = context;
+        event.begin_ns = begin_ns;
+        event.duration_ns = duration_ns;
+        thread_buffer->head.store( head + 1, std::memory_order_release );
+    }
+
+    TRaisimTraceThreadBuffer* TRaisimTraceRecorder::_GetThreadBuffer()
+    {
+        // Registration happens once per thread, so the lock is only taken on the first event of each thread
+        thread_local TRaisimTraceThreadBuffer* s_ThreadBuffer = nullptr;
+        if ( s_ThreadBuffer )
+            return s_ThreadBuffer;
+
+        std::lock_guard<std::mutex> lock( m_ThreadBuffersMutex );
+        auto thread_buffer = std::make_unique<TRaisimTraceThreadBuffer>();
+        thread_buffer->events = std::unique_ptr<TRaisimTraceEvent[]>( new TRaisimTraceEvent[m_EventsPerThread] );
+        thread_buffer->capacity_mask = m_EventsPerThread - 1;
+        thread_buffer->head = 0;
+        thread_buffer->thread_index = m_ThreadBuffers.size();
+        s_ThreadBuffer = thread_buffer.get();
+        m_ThreadBuffers.push_back( std::move( thread_buffer ) );
+        return s_ThreadBuffer;
+    }
+
+    std::string TRaisimTraceRecorder::ToChromeTraceJson() const
+    {
+        std::lock_guard<std::mutex> lock( m_ThreadBuffersMutex );
+        std::stringstream json;
+        json << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first_event = true;
+        for ( const auto& thread_buffer : m_ThreadBuffers )
+        {
+            const ssize_t tid = thread_buffer->thread_index;
+            json << ( first_event ? "" : "," ) << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << tid
+                 << ",\"args\":{\"name\":\"thread-" << tid << "\"}}";
+            first_event = false;
+
+            // Snapshot the ring, then drop the entries the owner thread might have overwritten meanwhile: while
+            // writing entry (head_after), the slot of entry (head_after - capacity) is being reused
+            const uint64_t head = thread_buffer->head.load( std::memory_order_acquire );
+            const uint64_t capacity = thread_buffer->capacity_mask + 1;
+            const uint64_t start = ( head > capacity ) ? head - capacity : 0;
+            std::vector<TRaisimTraceEvent> events;
+            events.reserve( head - start );
+            for ( uint64_t i = start; i < head; i++ )
+                events.push_back( thread_buffer->events[i & thread_buffer->capacity_mask] );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            const uint64_t head_after = thread_buffer->head.load( std::memory_order_relaxed );
+            const uint64_t start_valid = std::max( start, ( head_after >= capacity ) ? head_after - capacity + 1 : 0 );
+
+            for ( uint64_t i = std::min( start_valid, head ); i < head; i++ )
+            {
+                const auto& event = events[i - start];
+                // Timestamps are given in microseconds (keep ns resolution through the decimals)
+                json << ",\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+                     << ",\"ts\":" << std::fixed << std::setprecision( 3 ) << event.begin_ns * 1e-3
+                     << ",\"dur\":" << event.duration_ns * 1e-3
+                     << ",\"args\":{\"context\":\"" << loco::PointerToHexAddress( event.context ) << "\"}}";
+            }
+        }
+        json << "\n]}\n";
+        return json.str();
+    }
+
+    bool TRaisimTraceRecorder::DumpChromeTrace( const std::string& filepath ) const
+    {
+        std::ofstream file_trace( filepath );
+        if ( !file_trace.is_open() )
+        {
+            LOCO_CORE_ERROR( "TRaisimTraceRecorder::DumpChromeTrace >>> couldn't open file {0}", filepath );
+            return false;
+        }
+        file_trace << ToChromeTraceJson();
+        return true;
+    }
+
+}}
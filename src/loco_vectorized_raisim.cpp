@@ -0,0 +1,244 @@
+#include <loco_vectorized_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimVectorizedSimulation::TRaisimVectorizedSimulation( const std::vector<TScenario*>& scenarios,
+                                                              ssize_t num_threads,
+                                                              const eRaisimActionMode& action_mode,
+                                                              const std::unordered_map<std::string, std::string>& kintree_model_files )
+    {
+        LOCO_CORE_ASSERT( scenarios.size() > 0, "TRaisimVectorizedSimulation >>> requires at least one scenario" );
+
+        m_ActionMode = action_mode;
+        m_AutoReset = true;
+        m_ObservationDim = 0;
+        m_ActionDim = 0;
+        m_ThreadPool = std::make_unique<TRaisimThreadPool>( num_threads );
+
+        for ( ssize_t i = 0; i < scenarios.size(); i++ )
+        {
+            auto simulation = std::make_unique<TRaisimSimulation>( scenarios[i], true );
+            for ( const auto& name_filepath : kintree_model_files )
+                simulation->SetKintreeModelFile( name_filepath.first, name_filepath.second );
+            simulation->Initialize();
+
+            // Dynamic single-bodies go first (states of the batch-object), followed by the kintrees
+            ssize_t world_observation_dim = simulation->single_body_batch().num_dynamic_bodies() * TRaisimSingleBodyBatch::STATE_DIM;
+            ssize_t world_action_dim = 0;
+            for ( auto kintree_adapter : simulation->kintree_adapters() )
+            {
+                world_observation_dim += kintree_adapter->num_generalized_coordinates() + kintree_adapter->num_dofs();
+                world_action_dim += ( m_ActionMode == eRaisimActionMode::PD_TARGETS ) ? kintree_adapter->num_generalized_coordinates()
+                                                                                       : kintree_adapter->num_dofs();
+            }
+
+            if ( i == 0 )
+            {
+                m_ObservationDim = world_observation_dim;
+                m_ActionDim = world_action_dim;
+            }
+            LOCO_CORE_ASSERT( world_observation_dim == m_ObservationDim && world_action_dim == m_ActionDim,
+                              "TRaisimVectorizedSimulation >>> all scenarios must have the same layout, but world {0} \
+                              has obs-dim {1} and action-dim {2} (expected {3}, {4})", i, world_observation_dim,
+                              world_action_dim, m_ObservationDim, m_ActionDim );
+
+            m_KintreesAdapters.push_back( simulation->kintree_adapters() );
+            m_Simulations.push_back( std::move( simulation ) );
+        }
+
+        m_Observations.resize( m_Simulations.size() * m_ObservationDim, 0.0 );
+        m_TerminalObservations.resize( m_Simulations.size() * m_ObservationDim, 0.0 );
+        m_Snapshots.resize( m_Simulations.size() * m_ObservationDim, 0.0 );
+        m_Dones.resize( m_Simulations.size(), 0 );
+        m_EpisodeSteps.resize( m_Simulations.size(), 0 );
+        m_TerminationConditions.resize( m_Simulations.size() );
+        for ( ssize_t i = 0; i < m_Simulations.size(); i++ )
+            _CollectObservations( i );
+        SaveSnapshot();
+    }
+
+    TRaisimVectorizedSimulation::~TRaisimVectorizedSimulation()
+    {
+        m_ThreadPool = nullptr;
+        m_KintreesAdapters.clear();
+        m_Simulations.clear();
+    }
+
+    void TRaisimVectorizedSimulation::Step( const double* actions )
+    {
+        m_ThreadPool->ParallelFor( m_Simulations.size(), [&]( ssize_t world_index )
+            {
+                if ( actions )
+                    _ApplyActions( world_index, actions + world_index * m_ActionDim );
+                m_Simulations[world_index]->Step();
+                m_EpisodeSteps[world_index]++;
+                _CollectObservations( world_index );
+
+                m_Dones[world_index] = _IsTerminated( world_index ) ? 1 : 0;
+                if ( !m_Dones[world_index] )
+                    return;
+
+                // Keep the terminal observation, and start the next episode right away (no round-trip to the user)
+                const double* observations = m_Observations.data() + world_index * m_ObservationDim;
+                std::copy( observations, observations + m_ObservationDim, m_TerminalObservations.data() + world_index * m_ObservationDim );
+                if ( m_AutoReset )
+                {
+                    _RestoreState( world_index, m_Snapshots.data() + world_index * m_ObservationDim );
+                    m_EpisodeSteps[world_index] = 0;
+                    _CollectObservations( world_index );
+                }
+            } );
+    }
+
+    void TRaisimVectorizedSimulation::Reset()
+    {
+        m_ThreadPool->ParallelFor( m_Simulations.size(), [&]( ssize_t world_index )
+            {
+                m_Simulations[world_index]->Reset();
+                _CollectObservations( world_index );
+                m_Dones[world_index] = 0;
+                m_EpisodeSteps[world_index] = 0;
+            } );
+    }
+
+    void TRaisimVectorizedSimulation::_ApplyActions( ssize_t world_index, const double* actions )
+    {
+        for ( auto kintree_adapter : m_KintreesAdapters[world_index] )
+        {
+            if ( m_ActionMode == eRaisimActionMode::PD_TARGETS )
+            {
+                kintree_adapter->SetPdTargets( actions, nullptr );
+                actions += kintree_adapter->num_generalized_coordinates();
+            }
+            else
+            {
+                kintree_adapter->SetGeneralizedForces( actions );
+                actions += kintree_adapter->num_dofs();
+            }
+        }
+    }
+
+    bool TRaisimVectorizedSimulation::AddTerminationCondition( const eRaisimTerminationType& type,
+                                                               const std::string& target_name,
+                                                               double threshold )
+    {
+        std::vector<TRaisimTerminationCondition> world_conditions;
+        for ( ssize_t i = 0; i < m_Simulations.size(); i++ )
+        {
+            auto condition = TRaisimTerminationCondition();
+            condition.type = type;
+            condition.threshold = threshold;
+            condition.body_adapter_ref = nullptr;
+            condition.kintree_adapter_ref = nullptr;
+            if ( type != eRaisimTerminationType::TIME_LIMIT )
+            {
+                // Kintrees take precedence, as single-bodies are looked up by name only if there's no such kintree
+                if ( m_Simulations[i]->HasKintree( target_name ) )
+                    condition.kintree_adapter_ref = m_Simulations[i]->GetKintreeAdapterByName( target_name );
+                else
+                    condition.body_adapter_ref = m_Simulations[i]->GetSingleBodyAdapterByName( target_name );
+                if ( !condition.kintree_adapter_ref && !condition.body_adapter_ref )
+                {
+                    LOCO_CORE_ERROR( "TRaisimVectorizedSimulation::AddTerminationCondition >>> world {0} has no body nor \
+                                      kintree named {1}", i, target_name );
+                    return false;
+                }
+                if ( condition.kintree_adapter_ref && !condition.kintree_adapter_ref->has_floating_base() )
+                {
+                    LOCO_CORE_ERROR( "TRaisimVectorizedSimulation::AddTerminationCondition >>> kintree {0} must have a \
+                                      floating base to check its height|tilt", target_name );
+                    return false;
+                }
+            }
+            world_conditions.push_back( condition );
+        }
+
+        // Only register the predicate once it could be resolved for all worlds
+        for ( ssize_t i = 0; i < m_Simulations.size(); i++ )
+            m_TerminationConditions[i].push_back( world_conditions[i] );
+        return true;
+    }
+
+    void TRaisimVectorizedSimulation::SaveSnapshot()
+    {
+        for ( ssize_t i = 0; i < m_Simulations.size(); i++ )
+            _CollectState( i, m_Snapshots.data() + i * m_ObservationDim );
+    }
+
+    bool TRaisimVectorizedSimulation::_IsTerminated( ssize_t world_index ) const
+    {
+        for ( const auto& condition : m_TerminationConditions[world_index] )
+        {
+            if ( condition.type == eRaisimTerminationType::TIME_LIMIT )
+            {
+                if ( m_EpisodeSteps[world_index] >= condition.threshold )
+                    return true;
+                continue;
+            }
+
+            // Height and cos(tilt) (z-component of the body's z-axis) of the checked body|kintree-base
+            double height = 0.0, cos_tilt = 1.0;
+            if ( auto kintree_adapter = condition.kintree_adapter_ref )
+            {
+                const auto& gc = kintree_adapter->raisim_articulated_system()->getGeneralizedCoordinate();
+                height = gc[2];
+                cos_tilt = 1.0 - 2.0 * ( gc[4] * gc[4] + gc[5] * gc[5] );
+            }
+            else
+            {
+                auto raisim_body = condition.body_adapter_ref->raisim_body();
+                height = raisim_body->getPosition_W()[2];
+                cos_tilt = raisim_body->getRotation_W()( 2, 2 );
+            }
+
+            if ( condition.type == eRaisimTerminationType::BODY_BELOW_HEIGHT && height < condition.threshold )
+                return true;
+            if ( condition.type == eRaisimTerminationType::BODY_TILT_ABOVE && cos_tilt < std::cos( condition.threshold ) )
+                return true;
+        }
+        return false;
+    }
+
+    void TRaisimVectorizedSimulation::_CollectObservations( ssize_t world_index )
+    {
+        _CollectState( world_index, m_Observations.data() + world_index * m_ObservationDim );
+    }
+
+    void TRaisimVectorizedSimulation::_CollectState( ssize_t world_index, double* dst_observations ) const
+    {
+        const auto& single_body_batch = m_Simulations[world_index]->single_body_batch();
+        single_body_batch.GetStates( dst_observations );
+        dst_observations += single_body_batch.num_dynamic_bodies() * TRaisimSingleBodyBatch::STATE_DIM;
+        for ( auto kintree_adapter : m_KintreesAdapters[world_index] )
+        {
+            kintree_adapter->GetGeneralizedCoordinates( dst_observations );
+            dst_observations += kintree_adapter->num_generalized_coordinates();
+            kintree_adapter->GetGeneralizedVelocities( dst_observations );
+            dst_observations += kintree_adapter->num_dofs();
+        }
+    }
+
+    void TRaisimVectorizedSimulation::_RestoreState( ssize_t world_index, const double* state )
+    {
+        auto& single_body_batch = m_Simulations[world_index]->single_body_batch();
+        single_body_batch.SetStates( state );
+        state += single_body_batch.num_dynamic_bodies() * TRaisimSingleBodyBatch::STATE_DIM;
+        for ( auto kintree_adapter : m_KintreesAdapters[world_index] )
+        {
+            kintree_adapter->SetState( state, state + kintree_adapter->num_generalized_coordinates() );
+            state += kintree_adapter->num_generalized_coordinates() + kintree_adapter->num_dofs();
+        }
+    }
+
+    TRaisimMemoryReport TRaisimVectorizedSimulation::GetMemoryReport() const
+    {
+        TRaisimMemoryReport report;
+        for ( const auto& simulation : m_Simulations )
+            report += simulation->GetMemoryReport();
+        report.adapter_bytes += ( m_Observations.size() + m_TerminalObservations.size() + m_Snapshots.size() ) * sizeof( double );
+        report.adapter_bytes += m_Dones.size() * sizeof( uint8_t ) + m_EpisodeSteps.size() * sizeof( int64_t );
+        return report;
+    }
+
+}}
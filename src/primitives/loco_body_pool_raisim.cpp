@@ -0,0 +1,155 @@
+#include <primitives/loco_body_pool_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    // Height at which parked objects are placed (far away from anything being simulated)
+    constexpr double POOL_PARKING_HEIGHT = -1000.0;
+    // Tolerance used when matching the size of a requested shape to the one of a pool
+    constexpr double POOL_SIZE_TOLERANCE = 1e-6;
+
+    // Mass of the objects created from the given data (same rule as CreateSingleBody: from the shape's volume and
+    // the default density if no mass is given)
+    static double ComputePooledMass( const TShapeData& shape_data, const TInertialData& inertia_data )
+    {
+        return ( inertia_data.mass < loco::EPS ) ? loco::DEFAULT_DENSITY * loco::ComputeVolumeFromShape( shape_data )
+                                                 : inertia_data.mass;
+    }
+
+    TRaisimBodyPool::TRaisimBodyPool()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_NumActive = 0;
+    }
+
+    TRaisimBodyPool::~TRaisimBodyPool()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_Bodies.clear();
+        m_Pools.clear();
+    }
+
+    bool TRaisimBodyPool::Reserve( const TShapeData& shape_data, const TInertialData& inertia_data, ssize_t num_bodies )
+    {
+        LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimBodyPool::Reserve >>> raisim world-reference \
+                          required for creating pooled objects (not nullptr)" );
+
+        if ( shape_data.type != eShapeType::BOX && shape_data.type != eShapeType::SPHERE &&
+             shape_data.type != eShapeType::CYLINDER && shape_data.type != eShapeType::CAPSULE &&
+             shape_data.type != eShapeType::ELLIPSOID )
+        {
+            LOCO_CORE_ERROR( "TRaisimBodyPool::Reserve >>> only primitive shapes (box, sphere, cylinder, capsule \
+                              and ellipsoid) can be pooled, got {0}", ToString( shape_data.type ) );
+            return false;
+        }
+
+        const double mass = ComputePooledMass( shape_data, inertia_data );
+        ssize_t pool_index = _FindPool( shape_data, mass );
+        if ( pool_index < 0 )
+        {
+            auto pool = TRaisimShapePool();
+            pool.type = shape_data.type;
+            pool.size = shape_data.size;
+            pool.mass = mass;
+            m_Pools.push_back( pool );
+            pool_index = m_Pools.size() - 1;
+        }
+
+        for ( ssize_t i = 0; i < num_bodies; i++ )
+        {
+            auto pooled_body = TRaisimPooledBody();
+            pooled_body.raisim_body = CreateSingleBody( m_RaisimWorldRef, shape_data, inertia_data );
+            pooled_body.pool_index = pool_index;
+            pooled_body.active = false;
+            if ( !pooled_body.raisim_body )
+                return false;
+
+            _Park( pooled_body );
+            m_Pools[pool_index].free_handles.push_back( m_Bodies.size() );
+            m_Bodies.push_back( pooled_body );
+        }
+        return true;
+    }
+
+    ssize_t TRaisimBodyPool::Spawn( const TShapeData& shape_data,
+                                    const TInertialData& inertia_data,
+                                    const TMat4& transform,
+                                    const TVec3& linear_vel,
+                                    const TVec3& angular_vel )
+    {
+        const double mass = ComputePooledMass( shape_data, inertia_data );
+        const ssize_t pool_index = _FindPool( shape_data, mass );
+        if ( pool_index < 0 )
+        {
+            LOCO_CORE_ERROR( "TRaisimBodyPool::Spawn >>> there's no pool for shape {0} with size {1} and mass {2} \
+                              (must be reserved first)", ToString( shape_data.type ), ToString( shape_data.size ), mass );
+            return -1;
+        }
+
+        auto& free_handles = m_Pools[pool_index].free_handles;
+        if ( free_handles.empty() )
+            return -1;
+
+        const ssize_t handle = free_handles.back();
+        free_handles.pop_back();
+
+        auto& pooled_body = m_Bodies[handle];
+        auto raisim_body = pooled_body.raisim_body;
+        raisim_body->setPose( vec3_to_eigen( TVec3( transform.col( 3 ) ) ), mat3_to_eigen( TMat3( transform ) ) );
+        raisim_body->setBodyType( raisim::BodyType::DYNAMIC );
+        raisim_body->setVelocity( vec3_to_eigen( linear_vel ), vec3_to_eigen( angular_vel ) );
+        dGeomEnable( raisim_body->getCollisionObject() );
+        pooled_body.active = true;
+        m_NumActive++;
+        return handle;
+    }
+
+    bool TRaisimBodyPool::Despawn( ssize_t handle )
+    {
+        if ( !is_active( handle ) )
+        {
+            LOCO_CORE_ERROR( "TRaisimBodyPool::Despawn >>> there's no spawned body with handle {0}", handle );
+            return false;
+        }
+
+        auto& pooled_body = m_Bodies[handle];
+        _Park( pooled_body );
+        m_Pools[pooled_body.pool_index].free_handles.push_back( handle );
+        m_NumActive--;
+        return true;
+    }
+
+    void TRaisimBodyPool::DespawnAll()
+    {
+        for ( ssize_t handle = 0; handle < m_Bodies.size(); handle++ )
+            if ( m_Bodies[handle].active )
+                Despawn( handle );
+    }
+
+    ssize_t TRaisimBodyPool::_FindPool( const TShapeData& shape_data, double mass ) const
+    {
+        for ( ssize_t i = 0; i < m_Pools.size(); i++ )
+        {
+            if ( m_Pools[i].type != shape_data.type )
+                continue;
+            if ( std::abs( m_Pools[i].mass - mass ) > POOL_SIZE_TOLERANCE * std::max( 1.0, mass ) )
+                continue;
+            if ( std::abs( m_Pools[i].size.x() - shape_data.size.x() ) < POOL_SIZE_TOLERANCE &&
+                 std::abs( m_Pools[i].size.y() - shape_data.size.y() ) < POOL_SIZE_TOLERANCE &&
+                 std::abs( m_Pools[i].size.z() - shape_data.size.z() ) < POOL_SIZE_TOLERANCE )
+                return i;
+        }
+        return -1;
+    }
+
+    void TRaisimBodyPool::_Park( TRaisimPooledBody& pooled_body )
+    {
+        auto raisim_body = pooled_body.raisim_body;
+        dGeomDisable( raisim_body->getCollisionObject() );
+        raisim_body->setVelocity( Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero() );
+        raisim_body->setBodyType( raisim::BodyType::STATIC );
+        raisim_body->setPosition( 0.0, 0.0, POOL_PARKING_HEIGHT );
+        pooled_body.active = false;
+    }
+
+}}
@@ -1,9 +1,36 @@
 
 #include <primitives/loco_single_body_adapter_raisim.h>
+#include <loco_scene_file_raisim.h>
+#include <loco_allocs_raisim.h>
+#include <loco_trace_raisim.h>
 
 namespace loco {
 namespace raisimlib {
 
+    raisim::SingleBodyObject* BuildSingleBody( raisim::World* raisim_world,
+                                               TSingleBody* body_ref,
+                                               const TRaisimSceneFile* scene_file_ref,
+                                               const TRaisimHfieldFileSource* hfield_source_ref )
+    {
+        auto collider = body_ref->collider();
+        raisim::SingleBodyObject* raisim_body = nullptr;
+        if ( scene_file_ref )
+            if ( auto record = scene_file_ref->FindBody( body_ref->name() ) )
+                raisim_body = scene_file_ref->CreateBody( raisim_world, *record, collider->data(), body_ref->data().inertia );
+        if ( !raisim_body && hfield_source_ref && collider->shape() == eShapeType::HFIELD )
+            raisim_body = CreateHfieldFromFile( raisim_world, collider->data().size, *hfield_source_ref );
+        if ( !raisim_body )
+            raisim_body = CreateSingleBody( raisim_world, collider->data(), body_ref->data().inertia );
+        if ( !raisim_body )
+            return nullptr;
+
+        if ( body_ref->dyntype() == eDynamicsType::DYNAMIC )
+            raisim_body->setBodyType( raisim::BodyType::DYNAMIC );
+        else
+            raisim_body->setBodyType( raisim::BodyType::STATIC );
+        return raisim_body;
+    }
+
     TRaisimSingleBodyAdapter::TRaisimSingleBodyAdapter( TSingleBody* body_ref )
         : TISingleBodyAdapter( body_ref )
     {
@@ -12,19 +39,14 @@ namespace raisimlib {
 
         m_RaisimWorldRef = nullptr;
         m_RaisimBodyRef = nullptr;
+        m_SceneFileRef = nullptr;
+        m_HfieldSourceRef = nullptr;
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Created TRaisimSingleBodyAdapter {0} @ {1}", m_BodyRef->name(), loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Created TRaisimSingleBodyAdapter " << m_BodyRef->name() << " @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        LOCO_RAISIM_TRACK_CREATED( SINGLE_BODY_ADAPTER );
     }
 
     TRaisimSingleBodyAdapter::~TRaisimSingleBodyAdapter()
     {
-        const std::string name = ( m_BodyRef ) ? m_BodyRef->name() : "undefined";
-
         if ( m_BodyRef )
             m_BodyRef->DetachSim();
         m_BodyRef = nullptr;
@@ -32,30 +54,21 @@ namespace raisimlib {
         m_RaisimWorldRef = nullptr;
         m_RaisimBodyRef = nullptr;
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Destroyed TRaisimSingleBodyAdapter {0} @ {1}", name, loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Destroyed TRaisimSingleBodyAdapter " << name << " @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        LOCO_RAISIM_TRACK_DESTROYED( SINGLE_BODY_ADAPTER );
     }
 
     void TRaisimSingleBodyAdapter::Build()
     {
+        LOCO_RAISIM_TRACE_SCOPE( "single_body_build", m_RaisimWorldRef );
         auto collider = m_BodyRef->collider();
         LOCO_CORE_ASSERT( collider, "TRaisimSingleBodyAdapter::Build >>> collider of body {0} should \
                           be valid (not nullptr)", m_BodyRef->name() );
         LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimSingleBodyAdapter::Build >>> raisim world-reference \
                           required for building a single-object (not nullptr)" );
 
-        m_RaisimBodyRef = CreateSingleBody( m_RaisimWorldRef, collider->data(), m_BodyRef->data().inertia );
+        m_RaisimBodyRef = BuildSingleBody( m_RaisimWorldRef, m_BodyRef, m_SceneFileRef, m_HfieldSourceRef );
         LOCO_CORE_ASSERT( m_RaisimBodyRef, "TRaisimSingleBodyAdapter::Build >>> something wen't wrong while \
                           creating a raisim single-body-object for body {0}", m_BodyRef->name() );
-
-        if ( m_BodyRef->dyntype() == eDynamicsType::DYNAMIC )
-            m_RaisimBodyRef->setBodyType( raisim::BodyType::DYNAMIC );
-        else
-            m_RaisimBodyRef->setBodyType( raisim::BodyType::STATIC );
     }
 
     void TRaisimSingleBodyAdapter::Initialize()
@@ -76,6 +89,7 @@ namespace raisimlib {
 
     void TRaisimSingleBodyAdapter::Reset()
     {
+        LOCO_RAISIM_TRACE_SCOPE( "single_body_reset", m_RaisimWorldRef );
         _SetupInitialPose();
         if ( m_BodyRef->dyntype() == eDynamicsType::DYNAMIC )
             _SetupInitialVelocity();
@@ -0,0 +1,139 @@
+#include <primitives/loco_single_body_batch_raisim.h>
+#include <primitives/loco_single_body_collider_adapter_raisim.h>
+#include <primitives/loco_single_body_adapter_raisim.h>
+#include <primitives/loco_single_body_adapter.h>
+#include <loco_scene_file_raisim.h>
+#include <loco_trace_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    TRaisimSingleBodyBatch::TRaisimSingleBodyBatch()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_SceneFileRef = nullptr;
+    }
+
+    TRaisimSingleBodyBatch::~TRaisimSingleBodyBatch()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_BodiesRefs.clear();
+        m_ColliderAdaptersRefs.clear();
+        m_RaisimBodiesRefs.clear();
+    }
+
+    ssize_t TRaisimSingleBodyBatch::Add( TSingleBody* body_ref, TRaisimSingleBodyColliderAdapter* collider_adapter_ref )
+    {
+        LOCO_CORE_ASSERT( body_ref, "TRaisimSingleBodyBatch::Add >>> given body reference should be valid (not nullptr)" );
+
+        m_BodiesRefs.push_back( body_ref );
+        m_ColliderAdaptersRefs.push_back( collider_adapter_ref );
+        m_RaisimBodiesRefs.push_back( nullptr );
+        m_HfieldSourcesRefs.push_back( nullptr );
+        m_IsDynamic.push_back( body_ref->dyntype() == eDynamicsType::DYNAMIC ? 1 : 0 );
+        if ( m_IsDynamic.back() )
+            m_DynamicIndices.push_back( m_BodiesRefs.size() - 1 );
+        return m_BodiesRefs.size() - 1;
+    }
+
+    void TRaisimSingleBodyBatch::Build()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "single_body_batch_build", m_RaisimWorldRef );
+        LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimSingleBodyBatch::Build >>> raisim world-reference \
+                          required for building the single-objects (not nullptr)" );
+
+        for ( ssize_t i = 0; i < m_BodiesRefs.size(); i++ )
+        {
+            auto collider = m_BodiesRefs[i]->collider();
+            LOCO_CORE_ASSERT( collider, "TRaisimSingleBodyBatch::Build >>> collider of body {0} should \
+                              be valid (not nullptr)", m_BodiesRefs[i]->name() );
+
+            m_RaisimBodiesRefs[i] = BuildSingleBody( m_RaisimWorldRef, m_BodiesRefs[i], m_SceneFileRef, m_HfieldSourcesRefs[i] );
+            LOCO_CORE_ASSERT( m_RaisimBodiesRefs[i], "TRaisimSingleBodyBatch::Build >>> something wen't wrong while \
+                              creating a raisim single-body-object for body {0}", m_BodiesRefs[i]->name() );
+        }
+    }
+
+    void TRaisimSingleBodyBatch::Initialize()
+    {
+        const ssize_t num_bodies = m_BodiesRefs.size();
+        m_InitialPositions.resize( num_bodies );
+        m_InitialRotations.resize( num_bodies );
+        m_InitialLinearVelocities.resize( num_bodies );
+        m_InitialAngularVelocities.resize( num_bodies );
+        for ( ssize_t i = 0; i < num_bodies; i++ )
+        {
+            const auto tf0 = m_BodiesRefs[i]->tf0();
+            m_InitialPositions[i] = vec3_to_eigen( TVec3( tf0.col( 3 ) ) );
+            m_InitialRotations[i] = mat3_to_eigen( TMat3( tf0 ) );
+            m_InitialLinearVelocities[i] = vec3_to_eigen( m_BodiesRefs[i]->linear_vel0() );
+            m_InitialAngularVelocities[i] = vec3_to_eigen( m_BodiesRefs[i]->angular_vel0() );
+
+            if ( auto collider_adapter = m_ColliderAdaptersRefs[i] )
+            {
+                collider_adapter->SetRaisimBody( m_RaisimBodiesRefs[i] );
+                collider_adapter->Initialize();
+            }
+        }
+
+        Reset();
+    }
+
+    void TRaisimSingleBodyBatch::Reset()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "single_body_batch_reset", m_RaisimWorldRef );
+        for ( ssize_t i = 0; i < m_RaisimBodiesRefs.size(); i++ )
+        {
+            m_RaisimBodiesRefs[i]->setPose( m_InitialPositions[i], m_InitialRotations[i] );
+            if ( m_IsDynamic[i] )
+                m_RaisimBodiesRefs[i]->setVelocity( m_InitialLinearVelocities[i], m_InitialAngularVelocities[i] );
+        }
+    }
+
+    void TRaisimSingleBodyBatch::GetStates( double* dst_states ) const
+    {
+        for ( ssize_t i = 0; i < m_DynamicIndices.size(); i++ )
+        {
+            const auto raisim_body = m_RaisimBodiesRefs[m_DynamicIndices[i]];
+            const auto& position = raisim_body->getPosition_W();
+            const auto& quaternion = raisim_body->getQuat();
+            const auto& linear_vel = raisim_body->getLinearVelocity_W();
+            const auto& angular_vel = raisim_body->getAngularVelocity_W();
+            double* dst_state = dst_states + i * STATE_DIM;
+            for ( ssize_t j = 0; j < 3; j++ )
+            {
+                dst_state[j] = position[j];
+                dst_state[7 + j] = linear_vel[j];
+                dst_state[10 + j] = angular_vel[j];
+            }
+            for ( ssize_t j = 0; j < 4; j++ )
+                dst_state[3 + j] = quaternion[j];
+        }
+    }
+
+    void TRaisimSingleBodyBatch::SetStates( const double* states )
+    {
+        for ( ssize_t i = 0; i < m_DynamicIndices.size(); i++ )
+        {
+            const double* state = states + i * STATE_DIM;
+            auto raisim_body = m_RaisimBodiesRefs[m_DynamicIndices[i]];
+            raisim_body->setPosition( state[0], state[1], state[2] );
+            raisim_body->setOrientation( Eigen::Vector4d( state[3], state[4], state[5], state[6] ) );
+            raisim_body->setVelocity( state[7], state[8], state[9], state[10], state[11], state[12] );
+        }
+    }
+
+    size_t TRaisimSingleBodyBatch::memory_bytes() const
+    {
+        return m_BodiesRefs.capacity() * sizeof( TSingleBody* ) +
+               m_ColliderAdaptersRefs.capacity() * sizeof( TRaisimSingleBodyColliderAdapter* ) +
+               m_RaisimBodiesRefs.capacity() * sizeof( raisim::SingleBodyObject* ) +
+               m_HfieldSourcesRefs.capacity() * sizeof( TRaisimHfieldFileSource* ) +
+               ( m_InitialPositions.capacity() + m_InitialLinearVelocities.capacity() +
+                 m_InitialAngularVelocities.capacity() ) * sizeof( Eigen::Vector3d ) +
+               m_InitialRotations.capacity() * sizeof( Eigen::Matrix3d ) +
+               m_IsDynamic.capacity() * sizeof( uint8_t ) +
+               m_DynamicIndices.capacity() * sizeof( ssize_t );
+    }
+
+}}
@@ -1,5 +1,6 @@
 
 #include <primitives/loco_single_body_collider_adapter_raisim.h>
+#include <loco_allocs_raisim.h>
 
 namespace loco {
 namespace raisimlib {
@@ -13,19 +14,13 @@ namespace raisimlib {
         m_RaisimWorldRef = nullptr;
         m_RaisimBodyRef = nullptr;
         m_RaisimOdeGeom = nullptr;
+        m_RaisimHeightMapRef = nullptr;
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Created TRaisimSingleBodyColliderAdapter {0} @ {1}", m_ColliderRef->name(), loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Created TRaisimSingleBodyColliderAdapter " << m_ColliderRef->name() << " @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        LOCO_RAISIM_TRACK_CREATED( SINGLE_BODY_COLLIDER_ADAPTER );
     }
 
     TRaisimSingleBodyColliderAdapter::~TRaisimSingleBodyColliderAdapter()
     {
-        const std::string name = ( m_ColliderRef ) ? m_ColliderRef->name() : "undefined";
-
         if ( m_ColliderRef )
             m_ColliderRef->DetachSim();
         m_ColliderRef = nullptr;
@@ -33,13 +28,9 @@ namespace raisimlib {
         m_RaisimWorldRef = nullptr;
         m_RaisimBodyRef = nullptr;
         m_RaisimOdeGeom = nullptr;
+        m_RaisimHeightMapRef = nullptr;
 
-    #if defined( LOCO_CORE_USE_TRACK_ALLOCS )
-        if ( TLogger::IsActive() )
-            LOCO_CORE_TRACE( "Loco::Allocs: Destroyed TRaisimSingleBodyColliderAdapter {0} @ {1}", name, loco::PointerToHexAddress( this ) );
-        else
-            std::cout << "Loco::Allocs: Destroyed TRaisimSingleBodyColliderAdapter " << name << " @ " << loco::PointerToHexAddress( this ) << std::endl;
-    #endif
+        LOCO_RAISIM_TRACK_DESTROYED( SINGLE_BODY_COLLIDER_ADAPTER );
     }
 
     void TRaisimSingleBodyColliderAdapter::Build()
@@ -54,6 +45,9 @@ namespace raisimlib {
 
         // Grab ODE-geom handle for later usage
         m_RaisimOdeGeom = m_RaisimBodyRef->getCollisionObject();
+        // Keep a typed reference to the heightmap (if applicable) for height-queries
+        if ( m_ColliderRef->shape() == eShapeType::HFIELD )
+            m_RaisimHeightMapRef = dynamic_cast<raisim::HeightMap*>( m_RaisimBodyRef );
     }
 
     void TRaisimSingleBodyColliderAdapter::OnDetach()
@@ -141,6 +135,33 @@ namespace raisimlib {
         }
     }
 
+    std::vector<double> TRaisimSingleBodyColliderAdapter::SampleHeights( const std::vector<TVec3>& points ) const
+    {
+        std::vector<double> points_xyz( 3 * points.size() );
+        for ( ssize_t i = 0; i < points.size(); i++ )
+        {
+            points_xyz[3 * i + 0] = points[i].x();
+            points_xyz[3 * i + 1] = points[i].y();
+            points_xyz[3 * i + 2] = points[i].z();
+        }
+
+        std::vector<double> heights( points.size(), 0.0 );
+        SampleHeights( points_xyz.data(), points.size(), heights.data() );
+        return heights;
+    }
+
+    void TRaisimSingleBodyColliderAdapter::SampleHeights( const double* points_xyz, ssize_t num_points, double* dst_heights ) const
+    {
+        if ( !m_RaisimHeightMapRef )
+        {
+            LOCO_CORE_ERROR( "TRaisimSingleBodyColliderAdapter::SampleHeights >>> collider {0} is not a (built) \
+                              hfield, can't sample heights from it", m_ColliderRef->name() );
+            return;
+        }
+
+        SampleHeightsBilinear( GetHeightMapGridView( m_RaisimHeightMapRef ), points_xyz, num_points, dst_heights );
+    }
+
     void TRaisimSingleBodyColliderAdapter::ChangeCollisionGroup( int collisionGroup )
     {
         // @todo: remove from API, as should only be set during initialization
@@ -0,0 +1,117 @@
+#include <primitives/loco_static_merger_raisim.h>
+#include <primitives/loco_single_body_adapter.h>
+#include <loco_trace_raisim.h>
+
+#include <map>
+
+namespace loco {
+namespace raisimlib {
+
+    // Default size of the xy-cells used to group static bodies (in meters)
+    constexpr double STATIC_MERGER_DEFAULT_CELL_SIZE = 10.0;
+
+    TRaisimStaticMerger::TRaisimStaticMerger()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_CellSize = STATIC_MERGER_DEFAULT_CELL_SIZE;
+    }
+
+    TRaisimStaticMerger::~TRaisimStaticMerger()
+    {
+        m_RaisimWorldRef = nullptr;
+        m_BodiesRefs.clear();
+        m_Groups.clear();
+    }
+
+    bool TRaisimStaticMerger::CanMerge( const TSingleBody* body_ref )
+    {
+        if ( body_ref->dyntype() != eDynamicsType::STATIC )
+            return false;
+        const auto shape = body_ref->data().collision.type;
+        return ( shape == eShapeType::BOX || shape == eShapeType::SPHERE ||
+                 shape == eShapeType::CYLINDER || shape == eShapeType::CAPSULE );
+    }
+
+    ssize_t TRaisimStaticMerger::Add( TSingleBody* body_ref )
+    {
+        LOCO_CORE_ASSERT( body_ref && CanMerge( body_ref ), "TRaisimStaticMerger::Add >>> given body must be \
+                          valid (not nullptr), static and with a primitive shape" );
+
+        m_BodiesRefs.push_back( body_ref );
+        m_BodiesGroups.push_back( -1 );
+        m_BodiesChildren.push_back( -1 );
+        return m_BodiesRefs.size() - 1;
+    }
+
+    void TRaisimStaticMerger::Build()
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "static_merger_build", m_RaisimWorldRef );
+        LOCO_CORE_ASSERT( m_RaisimWorldRef, "TRaisimStaticMerger::Build >>> raisim world-reference \
+                          required for building the merged compounds (not nullptr)" );
+
+        // Group bodies by the xy-cell their initial position falls into (ordered, so the build is deterministic)
+        std::map<std::pair<int64_t, int64_t>, std::vector<ssize_t>> cells;
+        for ( ssize_t i = 0; i < m_BodiesRefs.size(); i++ )
+        {
+            const auto position = TVec3( m_BodiesRefs[i]->tf0().col( 3 ) );
+            const auto cell = std::make_pair( (int64_t)std::floor( position.x() / m_CellSize ),
+                                              (int64_t)std::floor( position.y() / m_CellSize ) );
+            cells[cell].push_back( i );
+        }
+
+        for ( const auto& cell_bodies : cells )
+        {
+            // The compound's frame is placed at the centroid of its bodies, which keeps the local offsets small
+            Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+            for ( auto index : cell_bodies.second )
+                centroid += vec3_to_eigen( TVec3( m_BodiesRefs[index]->tf0().col( 3 ) ) );
+            centroid /= (double)cell_bodies.second.size();
+
+            std::vector<TShapeData> shapes_data;
+            std::vector<TMat4> shapes_local_tfs;
+            for ( auto index : cell_bodies.second )
+            {
+                auto local_tf = m_BodiesRefs[index]->tf0();
+                const auto local_position = vec3_to_eigen( TVec3( local_tf.col( 3 ) ) ) - centroid;
+                local_tf.set( vec3_from_eigen( local_position ), 3 );
+                shapes_data.push_back( m_BodiesRefs[index]->data().collision );
+                shapes_local_tfs.push_back( local_tf );
+            }
+
+            auto group = TRaisimMergedStaticGroup();
+            TVec3 local_com;
+            group.raisim_compound = CreateCompound( m_RaisimWorldRef, shapes_data, shapes_local_tfs, TInertialData(), local_com );
+            group.bodies_indices = cell_bodies.second;
+            LOCO_CORE_ASSERT( group.raisim_compound, "TRaisimStaticMerger::Build >>> something went wrong while \
+                              creating a merged compound of {0} static bodies", cell_bodies.second.size() );
+            group.raisim_compound->setBodyType( raisim::BodyType::STATIC );
+            group.raisim_compound->setPose( centroid + vec3_to_eigen( local_com ), Eigen::Matrix3d::Identity() );
+
+            for ( ssize_t j = 0; j < cell_bodies.second.size(); j++ )
+            {
+                m_BodiesGroups[cell_bodies.second[j]] = m_Groups.size();
+                m_BodiesChildren[cell_bodies.second[j]] = j;
+            }
+            m_Groups.push_back( group );
+        }
+
+        LOCO_CORE_TRACE( "Raisim-backend >>> merged {0} static bodies into {1} compounds", m_BodiesRefs.size(), m_Groups.size() );
+    }
+
+    ssize_t TRaisimStaticMerger::FindBody( const std::string& body_name ) const
+    {
+        for ( ssize_t i = 0; i < m_BodiesRefs.size(); i++ )
+            if ( m_BodiesRefs[i]->name() == body_name )
+                return i;
+        return -1;
+    }
+
+    ssize_t TRaisimStaticMerger::FindBody( const raisim::Object* raisim_object, ssize_t child_index ) const
+    {
+        for ( const auto& group : m_Groups )
+            if ( group.raisim_compound == raisim_object )
+                return ( child_index >= 0 && child_index < group.bodies_indices.size() ) ? group.bodies_indices[child_index] : -1;
+        return -1;
+    }
+
+}}
@@ -0,0 +1,61 @@
+#include <sensors/loco_contact_sensors_raisim.h>
+#include <loco_trace_raisim.h>
+#include <primitives/loco_single_body_adapter_raisim.h>
+
+namespace loco {
+namespace raisimlib {
+
+    ssize_t TRaisimContactSensors::AddSensor( TRaisimSingleBodyAdapter* body_adapter_ref )
+    {
+        LOCO_CORE_ASSERT( body_adapter_ref, "TRaisimContactSensors::AddSensor >>> given body-adapter \
+                          reference should be valid (not nullptr)" );
+
+        m_BodyAdaptersRefs.push_back( body_adapter_ref );
+        m_Readings.push_back( { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, 0 } );
+        return m_Readings.size() - 1;
+    }
+
+    void TRaisimContactSensors::Update( double time_step )
+    {
+        LOCO_RAISIM_TRACE_SCOPE( "contact_sensors_update", this );
+        const double inv_time_step = 1.0 / time_step;
+        for ( ssize_t i = 0; i < m_BodyAdaptersRefs.size(); i++ )
+        {
+            auto& reading = m_Readings[i];
+            Eigen::Vector3d net_force = Eigen::Vector3d::Zero();
+            Eigen::Vector3d net_torque = Eigen::Vector3d::Zero();
+            ssize_t num_contacts = 0;
+
+            if ( auto raisim_body = m_BodyAdaptersRefs[i]->raisim_body() )
+            {
+                const Eigen::Vector3d com_position = raisim_body->getPosition();
+                for ( const auto& contact : raisim_body->getContacts() )
+                {
+                    if ( contact.skip() )
+                        continue;
+
+                    // Impulses are expressed in the contact-frame and act on object-A of the contact-pair
+                    const double sign = contact.isObjectA() ? inv_time_step : -inv_time_step;
+                    const Eigen::Vector3d force = sign * ( contact.getContactFrame().e().transpose() * contact.getImpulse()->e() );
+                    net_force += force;
+                    net_torque += ( contact.getPosition().e() - com_position ).cross( force );
+                    num_contacts++;
+                }
+            }
+
+            for ( ssize_t j = 0; j < 3; j++ )
+            {
+                reading.force[j] = net_force[j];
+                reading.torque[j] = net_torque[j];
+            }
+            reading.num_contacts = num_contacts;
+        }
+    }
+
+    void TRaisimContactSensors::Reset()
+    {
+        for ( auto& reading : m_Readings )
+            reading = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, 0 };
+    }
+
+}}
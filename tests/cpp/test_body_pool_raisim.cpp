@@ -0,0 +1,144 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <gtest/gtest.h>
+
+static loco::TShapeData CreateBoxShape( double extent )
+{
+    auto shape_data = loco::TShapeData();
+    shape_data.type = loco::eShapeType::BOX;
+    shape_data.size = { extent, extent, extent };
+    return shape_data;
+}
+
+static loco::TInertialData CreateInertia( double mass )
+{
+    auto inertia_data = loco::TInertialData();
+    inertia_data.mass = mass;
+    return inertia_data;
+}
+
+static loco::TMat4 CreateTransformAt( double x, double y, double z )
+{
+    loco::TMat4 transform;
+    transform.set( loco::TMat3() );
+    transform.set( loco::TVec3( x, y, z ), 3 );
+    return transform;
+}
+
+TEST( TestLocoRaisimBodyPool, TestSpawnDespawn )
+{
+    auto raisim_world = std::make_unique<raisim::World>();
+    loco::raisimlib::TRaisimBodyPool body_pool;
+    body_pool.SetRaisimWorld( raisim_world.get() );
+    ASSERT_TRUE( body_pool.Reserve( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), 2 ) );
+    EXPECT_EQ( body_pool.num_bodies(), 2 );
+    EXPECT_EQ( body_pool.num_active(), 0 );
+
+    // Spawned objects are dynamic, placed at the requested pose and moving with the requested velocity
+    const ssize_t handle = body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), CreateTransformAt( 1.0, 2.0, 3.0 ),
+                                            loco::TVec3( 0.5, 0.0, 0.0 ), loco::TVec3() );
+    ASSERT_GE( handle, 0 );
+    EXPECT_TRUE( body_pool.is_active( handle ) );
+    EXPECT_EQ( body_pool.num_active(), 1 );
+    auto raisim_body = body_pool.raisim_body( handle );
+    EXPECT_EQ( raisim_body->getBodyType(), raisim::BodyType::DYNAMIC );
+    EXPECT_NEAR( raisim_body->getPosition_W()[0], 1.0, 1e-6 );
+    EXPECT_NEAR( raisim_body->getPosition_W()[1], 2.0, 1e-6 );
+    EXPECT_NEAR( raisim_body->getPosition_W()[2], 3.0, 1e-6 );
+    EXPECT_NEAR( raisim_body->getLinearVelocity_W()[0], 0.5, 1e-6 );
+
+    // Despawned objects are parked (static, at rest, out of the way), and their handle can't be despawned twice
+    EXPECT_TRUE( body_pool.Despawn( handle ) );
+    EXPECT_FALSE( body_pool.is_active( handle ) );
+    EXPECT_EQ( body_pool.num_active(), 0 );
+    EXPECT_EQ( raisim_body->getBodyType(), raisim::BodyType::STATIC );
+    EXPECT_LT( raisim_body->getPosition_W()[2], -100.0 );
+    EXPECT_NEAR( raisim_body->getLinearVelocity_W()[0], 0.0, 1e-6 );
+    EXPECT_FALSE( body_pool.Despawn( handle ) );
+    EXPECT_FALSE( body_pool.Despawn( -1 ) );
+    EXPECT_FALSE( body_pool.Despawn( body_pool.num_bodies() ) );
+}
+
+TEST( TestLocoRaisimBodyPool, TestPoolKeyIncludesMass )
+{
+    auto raisim_world = std::make_unique<raisim::World>();
+    loco::raisimlib::TRaisimBodyPool body_pool;
+    body_pool.SetRaisimWorld( raisim_world.get() );
+    ASSERT_TRUE( body_pool.Reserve( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), 1 ) );
+    ASSERT_TRUE( body_pool.Reserve( CreateBoxShape( 0.2 ), CreateInertia( 5.0 ), 1 ) );
+    // No mass given, so it's computed from the volume (same shape, but different pool than the ones above)
+    ASSERT_TRUE( body_pool.Reserve( CreateBoxShape( 0.2 ), CreateInertia( 0.0 ), 1 ) );
+    EXPECT_EQ( body_pool.num_bodies(), 3 );
+
+    const auto transform = CreateTransformAt( 0.0, 0.0, 1.0 );
+    const ssize_t light_handle = body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() );
+    const ssize_t heavy_handle = body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 5.0 ), transform, loco::TVec3(), loco::TVec3() );
+    ASSERT_GE( light_handle, 0 );
+    ASSERT_GE( heavy_handle, 0 );
+    EXPECT_NEAR( body_pool.raisim_body( light_handle )->getMass(), 1.0, 1e-6 );
+    EXPECT_NEAR( body_pool.raisim_body( heavy_handle )->getMass(), 5.0, 1e-6 );
+
+    // Same shape, but no pool was reserved with this mass
+    EXPECT_EQ( body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 2.0 ), transform, loco::TVec3(), loco::TVec3() ), -1 );
+    // The density-based pool is found again when no mass is given
+    EXPECT_GE( body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 0.0 ), transform, loco::TVec3(), loco::TVec3() ), 0 );
+    EXPECT_EQ( body_pool.num_active(), 3 );
+}
+
+TEST( TestLocoRaisimBodyPool, TestPoolExhaustion )
+{
+    auto raisim_world = std::make_unique<raisim::World>();
+    loco::raisimlib::TRaisimBodyPool body_pool;
+    body_pool.SetRaisimWorld( raisim_world.get() );
+    ASSERT_TRUE( body_pool.Reserve( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), 2 ) );
+
+    const auto transform = CreateTransformAt( 0.0, 0.0, 1.0 );
+    const ssize_t handle_a = body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() );
+    const ssize_t handle_b = body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() );
+    ASSERT_GE( handle_a, 0 );
+    ASSERT_GE( handle_b, 0 );
+    EXPECT_NE( handle_a, handle_b );
+    EXPECT_EQ( body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() ), -1 );
+    EXPECT_EQ( body_pool.num_active(), 2 );
+    // Shapes that were never reserved (or can't be pooled) are rejected as well
+    EXPECT_EQ( body_pool.Spawn( CreateBoxShape( 0.3 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() ), -1 );
+    auto hfield_shape = loco::TShapeData();
+    hfield_shape.type = loco::eShapeType::HFIELD;
+    EXPECT_FALSE( body_pool.Reserve( hfield_shape, CreateInertia( 1.0 ), 1 ) );
+
+    // Despawning frees up an object that can be spawned again
+    ASSERT_TRUE( body_pool.Despawn( handle_a ) );
+    EXPECT_EQ( body_pool.Spawn( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), transform, loco::TVec3(), loco::TVec3() ), handle_a );
+}
+
+TEST( TestLocoRaisimBodyPool, TestResetParksSpawnedBodies )
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    ASSERT_TRUE( simulation->ReservePooledBodies( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), 3 ) );
+
+    std::vector<ssize_t> handles;
+    for ( ssize_t i = 0; i < 3; i++ )
+        handles.push_back( simulation->SpawnBody( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), CreateTransformAt( i, 0.0, 1.0 ) ) );
+    for ( auto handle : handles )
+        ASSERT_GE( handle, 0 );
+    EXPECT_EQ( simulation->SpawnBody( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), CreateTransformAt( 0.0, 0.0, 1.0 ) ), -1 );
+    for ( ssize_t i = 0; i < 10; i++ )
+        simulation->Step();
+
+    const auto& body_pool = simulation->body_pool();
+    EXPECT_EQ( body_pool.num_active(), 3 );
+    simulation->Reset();
+    EXPECT_EQ( body_pool.num_active(), 0 );
+    for ( auto handle : handles )
+    {
+        EXPECT_FALSE( body_pool.is_active( handle ) );
+        EXPECT_EQ( body_pool.raisim_body( handle )->getBodyType(), raisim::BodyType::STATIC );
+        EXPECT_LT( body_pool.raisim_body( handle )->getPosition_W()[2], -100.0 );
+    }
+
+    // All objects are available again after the reset
+    EXPECT_GE( simulation->SpawnBody( CreateBoxShape( 0.2 ), CreateInertia( 1.0 ), CreateTransformAt( 0.0, 0.0, 1.0 ) ), 0 );
+    EXPECT_EQ( body_pool.num_active(), 1 );
+}
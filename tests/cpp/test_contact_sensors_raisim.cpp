@@ -0,0 +1,73 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <gtest/gtest.h>
+
+static loco::TBodyData CreateBodyData( const loco::eShapeType& shape_type, const loco::TVec3& size,
+                                       const loco::eDynamicsType& dyntype, double mass )
+{
+    auto body_data = loco::TBodyData();
+    body_data.dyntype = dyntype;
+    body_data.collision.type = shape_type;
+    body_data.collision.size = size;
+    body_data.visual.type = shape_type;
+    body_data.visual.size = size;
+    body_data.inertia.mass = mass;
+    return body_data;
+}
+
+TEST( TestLocoRaisimContactSensors, TestBoxRestingOnGround )
+{
+    const double box_mass = 2.0;
+    auto scenario = std::make_unique<loco::TScenario>();
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "ground",
+                                CreateBodyData( loco::eShapeType::PLANE, { 10.0, 10.0, 1.0 }, loco::eDynamicsType::STATIC, 0.0 ),
+                                tinymath::Vector3f( 0.0, 0.0, 0.0 ), tinymath::Matrix3f() ) );
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "box",
+                                CreateBodyData( loco::eShapeType::BOX, { 0.2, 0.2, 0.2 }, loco::eDynamicsType::DYNAMIC, box_mass ),
+                                tinymath::Vector3f( 0.0, 0.0, 0.1 ), tinymath::Matrix3f() ) );
+    // Far above the ground, so it doesn't touch anything during the test
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "ball",
+                                CreateBodyData( loco::eShapeType::SPHERE, { 0.1, 0.1, 0.1 }, loco::eDynamicsType::DYNAMIC, 1.0 ),
+                                tinymath::Vector3f( 3.0, 0.0, 100.0 ), tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    simulation->Initialize();
+    const ssize_t box_sensor = simulation->AddContactSensor( "box" );
+    const ssize_t ball_sensor = simulation->AddContactSensor( "ball" );
+    ASSERT_EQ( box_sensor, 0 );
+    ASSERT_EQ( ball_sensor, 1 );
+    EXPECT_EQ( simulation->AddContactSensor( "missing" ), -1 );
+    const auto& contact_sensors = simulation->contact_sensors();
+    ASSERT_EQ( contact_sensors.num_sensors(), 2 );
+
+    for ( ssize_t i = 0; i < 30; i++ )
+        simulation->Step();
+
+    // At rest, the ground pushes the box up with its weight, through contacts placed symmetrically around its com
+    const double weight = box_mass * std::abs( simulation->raisim_world()->getGravity()[2] );
+    const auto& box_reading = contact_sensors.reading( box_sensor );
+    EXPECT_GT( box_reading.num_contacts, 0 );
+    EXPECT_NEAR( box_reading.force[0], 0.0, 1e-2 * weight );
+    EXPECT_NEAR( box_reading.force[1], 0.0, 1e-2 * weight );
+    EXPECT_NEAR( box_reading.force[2], weight, 5e-2 * weight );
+    for ( ssize_t j = 0; j < 3; j++ )
+        EXPECT_NEAR( box_reading.torque[j], 0.0, 1e-2 * weight );
+
+    const auto& ball_reading = contact_sensors.reading( ball_sensor );
+    EXPECT_EQ( ball_reading.num_contacts, 0 );
+    EXPECT_EQ( ball_reading.force[2], 0.0 );
+
+    // Resetting clears all readings, but keeps the sensors
+    simulation->Reset();
+    ASSERT_EQ( contact_sensors.num_sensors(), 2 );
+    for ( ssize_t i = 0; i < contact_sensors.num_sensors(); i++ )
+    {
+        const auto& reading = contact_sensors.readings()[i];
+        EXPECT_EQ( reading.num_contacts, 0 );
+        for ( ssize_t j = 0; j < 3; j++ )
+        {
+            EXPECT_EQ( reading.force[j], 0.0 );
+            EXPECT_EQ( reading.torque[j], 0.0 );
+        }
+    }
+}
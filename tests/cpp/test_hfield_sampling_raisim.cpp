@@ -0,0 +1,149 @@
+#include <loco_common_raisim.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+// Builds the samples of the plane z = a * x + b * y + c, which bilinear interpolation reproduces exactly
+static std::vector<double> CreatePlaneHeights( const loco::raisimlib::THeightMapGridView& grid,
+                                               double a, double b, double c )
+{
+    std::vector<double> heights( grid.nx_samples * grid.ny_samples, 0.0 );
+    for ( ssize_t i = 0; i < grid.ny_samples; i++ )
+    {
+        for ( ssize_t j = 0; j < grid.nx_samples; j++ )
+        {
+            const double x = grid.center_x - 0.5 * grid.size_x + j * grid.size_x / ( grid.nx_samples - 1 );
+            const double y = grid.center_y - 0.5 * grid.size_y + i * grid.size_y / ( grid.ny_samples - 1 );
+            heights[i * grid.nx_samples + j] = a * x + b * y + c;
+        }
+    }
+    return heights;
+}
+
+TEST( TestLocoRaisimHfieldSampling, TestSampleHeightsBilinearPlane )
+{
+    auto grid = loco::raisimlib::THeightMapGridView();
+    grid.nx_samples = 33;
+    grid.ny_samples = 17;
+    grid.size_x = 8.0;
+    grid.size_y = 4.0;
+    grid.center_x = 1.0;
+    grid.center_y = -0.5;
+    const auto heights = CreatePlaneHeights( grid, 0.3, -0.2, 0.1 );
+    grid.heights = heights.data();
+
+    // Use a number of points that's not a multiple of the simd-width to exercise both kernel paths
+    const ssize_t num_points = 103;
+    std::mt19937 rng( 0 );
+    std::uniform_real_distribution<double> dist_x( grid.center_x - 0.5 * grid.size_x, grid.center_x + 0.5 * grid.size_x );
+    std::uniform_real_distribution<double> dist_y( grid.center_y - 0.5 * grid.size_y, grid.center_y + 0.5 * grid.size_y );
+    std::vector<double> points_xyz( 3 * num_points, 0.0 );
+    for ( ssize_t p = 0; p < num_points; p++ )
+    {
+        points_xyz[3 * p + 0] = dist_x( rng );
+        points_xyz[3 * p + 1] = dist_y( rng );
+    }
+
+    std::vector<double> sampled( num_points, 0.0 );
+    loco::raisimlib::SampleHeightsBilinear( grid, points_xyz.data(), num_points, sampled.data() );
+    for ( ssize_t p = 0; p < num_points; p++ )
+    {
+        const double expected = 0.3 * points_xyz[3 * p + 0] - 0.2 * points_xyz[3 * p + 1] + 0.1;
+        EXPECT_NEAR( sampled[p], expected, 1e-9 );
+    }
+}
+
+TEST( TestLocoRaisimHfieldSampling, TestSampleHeightsBilinearClampsOutOfBounds )
+{
+    auto grid = loco::raisimlib::THeightMapGridView();
+    grid.nx_samples = 2;
+    grid.ny_samples = 2;
+    grid.size_x = 2.0;
+    grid.size_y = 2.0;
+    grid.center_x = 0.0;
+    grid.center_y = 0.0;
+    const std::vector<double> heights = { 0.0, 1.0,
+                                          2.0, 3.0 };
+    grid.heights = heights.data();
+
+    const std::vector<double> points_xyz = { -5.0, -5.0, 0.0,
+                                              5.0, -5.0, 0.0,
+                                             -5.0,  5.0, 0.0,
+                                              5.0,  5.0, 0.0,
+                                              0.0,  0.0, 0.0 };
+    std::vector<double> sampled( 5, 0.0 );
+    loco::raisimlib::SampleHeightsBilinear( grid, points_xyz.data(), 5, sampled.data() );
+    EXPECT_DOUBLE_EQ( sampled[0], 0.0 );
+    EXPECT_DOUBLE_EQ( sampled[1], 1.0 );
+    EXPECT_DOUBLE_EQ( sampled[2], 2.0 );
+    EXPECT_DOUBLE_EQ( sampled[3], 3.0 );
+    EXPECT_DOUBLE_EQ( sampled[4], 1.5 );
+}
+
+// Compares against raisim's own heightmap queries, so a flipped axis or misplaced origin in the kernels is caught.
+// Raisim interpolates within the two triangles of each cell (not bilinearly), so both only agree exactly on the
+// samples themselves and on planar terrain, which is what's checked here
+TEST( TestLocoRaisimHfieldSampling, TestSampleHeightsBilinearMatchesRaisimHeightMap )
+{
+    const size_t nx_samples = 21, ny_samples = 13;
+    const double size_x = 6.0, size_y = 3.0, center_x = 2.0, center_y = -1.0;
+    std::mt19937 rng( 1 );
+    std::uniform_real_distribution<double> dist_z( 0.0, 1.0 );
+
+    // Random heights: every sample must be found at the same xy-location by both
+    {
+        std::vector<double> heights( nx_samples * ny_samples );
+        for ( auto& height : heights )
+            height = dist_z( rng );
+        raisim::World world;
+        auto raisim_hmap = world.addHeightMap( nx_samples, ny_samples, size_x, size_y, center_x, center_y, heights );
+        const auto grid = loco::raisimlib::GetHeightMapGridView( raisim_hmap );
+
+        std::vector<double> points_xyz;
+        for ( size_t i = 0; i < ny_samples; i++ )
+        {
+            for ( size_t j = 0; j < nx_samples; j++ )
+            {
+                points_xyz.push_back( center_x - 0.5 * size_x + j * size_x / ( nx_samples - 1 ) );
+                points_xyz.push_back( center_y - 0.5 * size_y + i * size_y / ( ny_samples - 1 ) );
+                points_xyz.push_back( 0.0 );
+            }
+        }
+        const ssize_t num_points = points_xyz.size() / 3;
+        std::vector<double> sampled( num_points, 0.0 );
+        loco::raisimlib::SampleHeightsBilinear( grid, points_xyz.data(), num_points, sampled.data() );
+        for ( ssize_t p = 0; p < num_points; p++ )
+            EXPECT_NEAR( sampled[p], raisim_hmap->getHeight( points_xyz[3 * p + 0], points_xyz[3 * p + 1] ), 1e-9 );
+    }
+
+    // Planar (but tilted along both axes) terrain: random points anywhere on it must match
+    {
+        std::vector<double> heights( nx_samples * ny_samples );
+        for ( size_t i = 0; i < ny_samples; i++ )
+        {
+            for ( size_t j = 0; j < nx_samples; j++ )
+            {
+                const double x = center_x - 0.5 * size_x + j * size_x / ( nx_samples - 1 );
+                const double y = center_y - 0.5 * size_y + i * size_y / ( ny_samples - 1 );
+                heights[i * nx_samples + j] = 0.25 * x - 0.4 * y + 1.0;
+            }
+        }
+        raisim::World world;
+        auto raisim_hmap = world.addHeightMap( nx_samples, ny_samples, size_x, size_y, center_x, center_y, heights );
+        const auto grid = loco::raisimlib::GetHeightMapGridView( raisim_hmap );
+
+        const ssize_t num_points = 101;
+        std::uniform_real_distribution<double> dist_x( center_x - 0.5 * size_x, center_x + 0.5 * size_x );
+        std::uniform_real_distribution<double> dist_y( center_y - 0.5 * size_y, center_y + 0.5 * size_y );
+        std::vector<double> points_xyz( 3 * num_points, 0.0 );
+        for ( ssize_t p = 0; p < num_points; p++ )
+        {
+            points_xyz[3 * p + 0] = dist_x( rng );
+            points_xyz[3 * p + 1] = dist_y( rng );
+        }
+        std::vector<double> sampled( num_points, 0.0 );
+        loco::raisimlib::SampleHeightsBilinear( grid, points_xyz.data(), num_points, sampled.data() );
+        for ( ssize_t p = 0; p < num_points; p++ )
+            EXPECT_NEAR( sampled[p], raisim_hmap->getHeight( points_xyz[3 * p + 0], points_xyz[3 * p + 1] ), 1e-9 );
+    }
+}
@@ -0,0 +1,71 @@
+#include <loco_hfield_source_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+static const std::string TEST_HFIELD_FILEPATH = "./test_hfield_source_raisim.bin";
+
+// Writes the given int16 samples after a header of the given number of bytes
+static void WriteInt16HfieldFile( const std::string& filepath, size_t header_bytes, const std::vector<int16_t>& samples )
+{
+    std::ofstream file( filepath, std::ios::binary | std::ios::trunc );
+    const std::vector<char> header( header_bytes, 'h' );
+    file.write( header.data(), header.size() );
+    file.write( reinterpret_cast<const char*>( samples.data() ), samples.size() * sizeof( int16_t ) );
+}
+
+TEST( TestLocoRaisimHfieldSource, TestCreateHfieldFromInt16File )
+{
+    const std::vector<int16_t> samples = { -100, 0, 100, 250, -32768, 32767 };
+    WriteInt16HfieldFile( TEST_HFIELD_FILEPATH, 16, samples );
+
+    auto source = loco::raisimlib::TRaisimHfieldFileSource();
+    source.filepath = TEST_HFIELD_FILEPATH;
+    source.sample_type = loco::raisimlib::eRaisimHfieldSampleType::INT16;
+    source.nx_samples = 3;
+    source.ny_samples = 2;
+    source.header_bytes = 16;
+    source.scale = 0.01;
+    source.offset = 0.5;
+    EXPECT_EQ( loco::raisimlib::HfieldSampleBytes( source.sample_type ), sizeof( int16_t ) );
+
+    auto raisim_world = std::make_unique<raisim::World>();
+    auto raisim_hmap = loco::raisimlib::CreateHfieldFromFile( raisim_world.get(), loco::TVec3( 4.0, 2.0, 2.0 ), source );
+    ASSERT_TRUE( raisim_hmap != nullptr );
+    EXPECT_EQ( raisim_hmap->getXSamples(), 3 );
+    EXPECT_EQ( raisim_hmap->getYSamples(), 2 );
+
+    // Samples are decoded as size.z * ( raw * scale + offset ), in file (row-major) order
+    const auto& heights = raisim_hmap->getHeightMap();
+    ASSERT_EQ( heights.size(), samples.size() );
+    for ( ssize_t i = 0; i < samples.size(); i++ )
+        EXPECT_NEAR( heights[i], 2.0 * ( samples[i] * 0.01 + 0.5 ), 1e-9 );
+    std::remove( TEST_HFIELD_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimHfieldSource, TestRejectsShortFiles )
+{
+    auto source = loco::raisimlib::TRaisimHfieldFileSource();
+    source.filepath = TEST_HFIELD_FILEPATH;
+    source.sample_type = loco::raisimlib::eRaisimHfieldSampleType::INT16;
+    source.nx_samples = 3;
+    source.ny_samples = 2;
+    source.header_bytes = 16;
+    auto raisim_world = std::make_unique<raisim::World>();
+
+    // One sample short (the header counts towards the required size)
+    WriteInt16HfieldFile( TEST_HFIELD_FILEPATH, 16, { 1, 2, 3, 4, 5 } );
+    EXPECT_TRUE( loco::raisimlib::CreateHfieldFromFile( raisim_world.get(), loco::TVec3( 1.0, 1.0, 1.0 ), source ) == nullptr );
+    WriteInt16HfieldFile( TEST_HFIELD_FILEPATH, 0, { 1, 2, 3, 4, 5, 6 } );
+    EXPECT_TRUE( loco::raisimlib::CreateHfieldFromFile( raisim_world.get(), loco::TVec3( 1.0, 1.0, 1.0 ), source ) == nullptr );
+
+    // Missing files, and grids with less than 2x2 samples
+    std::remove( TEST_HFIELD_FILEPATH.c_str() );
+    EXPECT_TRUE( loco::raisimlib::CreateHfieldFromFile( raisim_world.get(), loco::TVec3( 1.0, 1.0, 1.0 ), source ) == nullptr );
+    WriteInt16HfieldFile( TEST_HFIELD_FILEPATH, 0, { 1, 2, 3, 4, 5, 6 } );
+    source.header_bytes = 0;
+    source.ny_samples = 1;
+    EXPECT_TRUE( loco::raisimlib::CreateHfieldFromFile( raisim_world.get(), loco::TVec3( 1.0, 1.0, 1.0 ), source ) == nullptr );
+    std::remove( TEST_HFIELD_FILEPATH.c_str() );
+}
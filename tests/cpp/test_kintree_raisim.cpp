@@ -0,0 +1,191 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+static const std::string TEST_URDF_FILEPATH = "./test_kintree_raisim.urdf";
+
+// Floating-base pendulum: a box base with a capsule link attached through a revolute joint
+static const std::string TEST_URDF_MODEL = R"(<?xml version="1.0"?>
+<robot name="pendulum">
+  <link name="base">
+    <inertial><mass value="1.0"/><inertia ixx="0.01" ixy="0" ixz="0" iyy="0.01" iyz="0" izz="0.01"/></inertial>
+    <collision><geometry><box size="0.2 0.2 0.2"/></geometry></collision>
+  </link>
+  <link name="arm">
+    <inertial><origin xyz="0 0 -0.25"/><mass value="0.5"/><inertia ixx="0.01" ixy="0" ixz="0" iyy="0.01" iyz="0" izz="0.001"/></inertial>
+    <collision><origin xyz="0 0 -0.25"/><geometry><capsule radius="0.05" length="0.4"/></geometry></collision>
+  </link>
+  <joint name="hinge" type="revolute">
+    <parent link="base"/><child link="arm"/><origin xyz="0 0 -0.1"/><axis xyz="0 1 0"/>
+    <limit lower="-3.14" upper="3.14" effort="100" velocity="100"/>
+  </joint>
+</robot>
+)";
+
+TEST( TestLocoRaisimKintree, TestBuildStepAndReset )
+{
+    std::ofstream( TEST_URDF_FILEPATH, std::ios::trunc ) << TEST_URDF_MODEL;
+
+    auto scenario = std::make_unique<loco::TScenario>();
+    auto kintree = scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "pendulum_0", tinymath::Vector3f( 0.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+    // No model file is given for this one, so it's left out of the simulation
+    scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "pendulum_1", tinymath::Vector3f( 1.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    ASSERT_TRUE( simulation->SetKintreeModelFile( "pendulum_0", TEST_URDF_FILEPATH ) );
+    EXPECT_FALSE( simulation->SetKintreeModelFile( "missing_kintree", TEST_URDF_FILEPATH ) );
+    simulation->Initialize();
+
+    ASSERT_EQ( simulation->kintree_adapters().size(), 1 );
+    auto kintree_adapter = simulation->GetKintreeAdapterByName( "pendulum_0" );
+    ASSERT_TRUE( kintree_adapter != nullptr );
+    ASSERT_TRUE( kintree_adapter->raisim_articulated_system() != nullptr );
+    EXPECT_EQ( kintree_adapter->num_generalized_coordinates(), 8 );
+    EXPECT_EQ( kintree_adapter->num_dofs(), 7 );
+    EXPECT_EQ( kintree_adapter->num_links(), 2 );
+    EXPECT_TRUE( kintree_adapter->has_floating_base() );
+
+    std::vector<double> gc( kintree_adapter->num_generalized_coordinates() );
+    kintree_adapter->GetGeneralizedCoordinates( gc.data() );
+    EXPECT_NEAR( gc[2], 2.0, 1e-6 );
+
+    // The kintree free-falls, and the loco kintree follows the pose of its root link
+    for ( ssize_t i = 0; i < 10; i++ )
+        simulation->Step();
+    kintree_adapter->GetGeneralizedCoordinates( gc.data() );
+    EXPECT_LT( gc[2], 2.0 - 1e-3 );
+    EXPECT_NEAR( kintree->tf()( 2, 3 ), gc[2], 1e-4 );
+
+    simulation->Reset();
+    kintree_adapter->GetGeneralizedCoordinates( gc.data() );
+    EXPECT_NEAR( gc[2], 2.0, 1e-6 );
+
+    std::remove( TEST_URDF_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimKintree, TestJointControllerOffsetsAndTracking )
+{
+    std::ofstream( TEST_URDF_FILEPATH, std::ios::trunc ) << TEST_URDF_MODEL;
+
+    auto scenario = std::make_unique<loco::TScenario>();
+    scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "pendulum_0", tinymath::Vector3f( 0.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+    scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "pendulum_1", tinymath::Vector3f( 1.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    ASSERT_TRUE( simulation->SetKintreeModelFile( "pendulum_0", TEST_URDF_FILEPATH ) );
+    ASSERT_TRUE( simulation->SetKintreeModelFile( "pendulum_1", TEST_URDF_FILEPATH ) );
+    simulation->Initialize();
+
+    // Buffers are the concatenation of the per-kintree buffers, in kintree order
+    auto& joint_controller = simulation->joint_controller();
+    ASSERT_EQ( joint_controller.num_kintrees(), 2 );
+    EXPECT_EQ( joint_controller.total_generalized_coordinates(), 16 );
+    EXPECT_EQ( joint_controller.total_dofs(), 14 );
+    EXPECT_EQ( joint_controller.offset_generalized_coordinates( 0 ), 0 );
+    EXPECT_EQ( joint_controller.offset_generalized_coordinates( 1 ), 8 );
+    EXPECT_EQ( joint_controller.offset_dofs( 0 ), 0 );
+    EXPECT_EQ( joint_controller.offset_dofs( 1 ), 7 );
+
+    // Only the hinges are actuated (each towards a different target), the floating-bases are left free
+    std::vector<double> kp( joint_controller.total_dofs(), 0.0 ), kd( joint_controller.total_dofs(), 0.0 );
+    kp[6] = kp[13] = 50.0;
+    kd[6] = kd[13] = 5.0;
+    joint_controller.SetGains( kp.data(), kd.data() );
+
+    std::vector<double> q_targets( joint_controller.total_generalized_coordinates(), 0.0 );
+    q_targets[7] = 0.5;
+    q_targets[15] = -0.3;
+    joint_controller.SetTargets( q_targets.data(), nullptr );
+
+    // While free-falling only the pd-torques act on the hinges, so both should settle at their own targets
+    for ( ssize_t i = 0; i < 500; i++ )
+        simulation->Step();
+
+    std::vector<double> gc_0( 8 ), gc_1( 8 );
+    simulation->GetKintreeAdapterByName( "pendulum_0" )->GetGeneralizedCoordinates( gc_0.data() );
+    simulation->GetKintreeAdapterByName( "pendulum_1" )->GetGeneralizedCoordinates( gc_1.data() );
+    EXPECT_NEAR( gc_0[7], 0.5, 5e-2 );
+    EXPECT_NEAR( gc_1[7], -0.3, 5e-2 );
+
+    std::remove( TEST_URDF_FILEPATH.c_str() );
+}
+
+static const std::string TEST_URDF_FILEPATH_SINGLE_LINK = "./test_kintree_raisim_single_link.urdf";
+
+// Floating-base box with no joints (single link)
+static const std::string TEST_URDF_MODEL_SINGLE_LINK = R"(<?xml version="1.0"?>
+<robot name="box">
+  <link name="base">
+    <inertial><mass value="1.0"/><inertia ixx="0.01" ixy="0" ixz="0" iyy="0.01" iyz="0" izz="0.01"/></inertial>
+    <collision><geometry><box size="0.2 0.2 0.2"/></geometry></collision>
+  </link>
+</robot>
+)";
+
+TEST( TestLocoRaisimKintree, TestLinkFramesArePaddedPerKintree )
+{
+    std::ofstream( TEST_URDF_FILEPATH, std::ios::trunc ) << TEST_URDF_MODEL;
+    std::ofstream( TEST_URDF_FILEPATH_SINGLE_LINK, std::ios::trunc ) << TEST_URDF_MODEL_SINGLE_LINK;
+
+    auto scenario = std::make_unique<loco::TScenario>();
+    scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "box_0", tinymath::Vector3f( 0.0, 0.0, 1.0 ), tinymath::Matrix3f() ) );
+    scenario->AddKinematicTree( std::make_unique<loco::TKinematicTree>( "pendulum_0", tinymath::Vector3f( 1.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get() );
+    ASSERT_TRUE( simulation->SetKintreeModelFile( "box_0", TEST_URDF_FILEPATH_SINGLE_LINK ) );
+    ASSERT_TRUE( simulation->SetKintreeModelFile( "pendulum_0", TEST_URDF_FILEPATH ) );
+    simulation->Initialize();
+    ASSERT_EQ( simulation->max_num_links(), 2 );
+
+    // Buffers start dirty, so stale padding would show up
+    const ssize_t num_kintrees = 2, max_num_links = simulation->max_num_links();
+    std::vector<double> frames( num_kintrees * max_num_links * 7, 42.0 );
+    std::vector<double> velocities( num_kintrees * max_num_links * 6, 42.0 );
+    simulation->GetKintreesLinkFrames( frames.data(), velocities.data() );
+
+    // Root links are at the kintrees' start poses, with identity orientations [qw, qx, qy, qz]
+    const double expected_root_0[7] = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
+    const double expected_root_1[7] = { 1.0, 0.0, 2.0, 1.0, 0.0, 0.0, 0.0 };
+    for ( ssize_t j = 0; j < 7; j++ )
+    {
+        EXPECT_NEAR( frames[j], expected_root_0[j], 1e-6 );
+        EXPECT_NEAR( frames[7 * max_num_links + j], expected_root_1[j], 1e-6 );
+    }
+
+    // The box has a single link, so its second slot is zeroed
+    for ( ssize_t j = 0; j < 7; j++ )
+        EXPECT_EQ( frames[7 + j], 0.0 );
+    for ( ssize_t j = 0; j < 6; j++ )
+        EXPECT_EQ( velocities[6 + j], 0.0 );
+
+    // The pendulum's arm is attached below its base, and nothing moves yet
+    EXPECT_NEAR( frames[7 * max_num_links + 7 + 2], 2.0 - 0.1, 1e-6 );
+    for ( ssize_t j = 0; j < num_kintrees * max_num_links * 6; j++ )
+        EXPECT_NEAR( velocities[j], 0.0, 1e-9 );
+
+    std::remove( TEST_URDF_FILEPATH.c_str() );
+    std::remove( TEST_URDF_FILEPATH_SINGLE_LINK.c_str() );
+}
+
+TEST( TestLocoRaisimKintree, TestSpreadRowsInPlace )
+{
+    // A packed 3x2 block spread into a 3x4 layout keeps every row, and zeroes the padding
+    std::vector<double> data = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 };
+    loco::raisimlib::SpreadRowsInPlace( data.data(), 3, 2, 4 );
+    const std::vector<double> expected = { 1.0, 2.0, 0.0, 0.0, 3.0, 4.0, 0.0, 0.0, 5.0, 6.0, 0.0, 0.0 };
+    EXPECT_EQ( data, expected );
+
+    // Rows overlapping their destination (stride < 2 * cols) must not get corrupted
+    std::vector<double> data_overlap = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, -1.0, -1.0, -1.0 };
+    loco::raisimlib::SpreadRowsInPlace( data_overlap.data(), 3, 3, 4 );
+    const std::vector<double> expected_overlap = { 1.0, 2.0, 3.0, 0.0, 4.0, 5.0, 6.0, 0.0, 7.0, 8.0, 9.0, 0.0 };
+    EXPECT_EQ( data_overlap, expected_overlap );
+
+    // Already-packed layouts are left untouched
+    std::vector<double> data_packed = { 1.0, 2.0, 3.0, 4.0 };
+    loco::raisimlib::SpreadRowsInPlace( data_packed.data(), 2, 2, 2 );
+    EXPECT_EQ( data_packed, std::vector<double>( { 1.0, 2.0, 3.0, 4.0 } ) );
+}
@@ -0,0 +1,89 @@
+#include <loco_memory_raisim.h>
+#include <gtest/gtest.h>
+
+// Report of a single world with the given object counts|bytes, and one asset per object-type
+static loco::raisimlib::TRaisimMemoryReport CreateTestReport( ssize_t num_boxes, ssize_t num_spheres, size_t scale )
+{
+    auto report = loco::raisimlib::TRaisimMemoryReport();
+    report.num_worlds = 1;
+    report.num_objects_per_type["box"] = num_boxes;
+    report.object_bytes_per_type["box"] = num_boxes * 100 * scale;
+    if ( num_spheres > 0 )
+    {
+        report.num_objects_per_type["sphere"] = num_spheres;
+        report.object_bytes_per_type["sphere"] = num_spheres * 80 * scale;
+    }
+    report.hfield_bytes = 1000 * scale;
+    report.core_hfield_bytes = 500 * scale;
+    report.hfield_build_copy_bytes = 1000 * scale;
+    report.estimated_mesh_bytes = 300 * scale;
+    report.contact_bytes = 200 * scale;
+    report.estimated_dynamics_bytes = 50 * scale;
+    report.adapter_bytes = 10 * scale;
+    report.assets.push_back( { "box_asset_" + std::to_string( scale ), "box", 100 * scale } );
+    report.assets.push_back( { "sphere_asset_" + std::to_string( scale ), "sphere", 80 * scale } );
+    return report;
+}
+
+TEST( TestLocoRaisimMemory, TestTotalBytes )
+{
+    const auto report = CreateTestReport( 2, 1, 1 );
+    EXPECT_EQ( report.object_bytes(), 2 * 100 + 80 );
+    // The transient build-copy isn't resident, so it's not part of the total
+    EXPECT_EQ( report.total_bytes(), report.object_bytes() + 1000 + 500 + 300 + 200 + 50 + 10 );
+}
+
+TEST( TestLocoRaisimMemory, TestAccumulateReports )
+{
+    auto report = CreateTestReport( 2, 0, 1 );
+    report += CreateTestReport( 3, 4, 2 );
+
+    EXPECT_EQ( report.num_worlds, 2 );
+    EXPECT_EQ( report.num_objects_per_type.at( "box" ), 5 );
+    EXPECT_EQ( report.num_objects_per_type.at( "sphere" ), 4 );
+    EXPECT_EQ( report.object_bytes_per_type.at( "box" ), 2 * 100 + 3 * 200 );
+    EXPECT_EQ( report.object_bytes_per_type.at( "sphere" ), 4 * 160 );
+    EXPECT_EQ( report.hfield_bytes, 3000 );
+    EXPECT_EQ( report.core_hfield_bytes, 1500 );
+    EXPECT_EQ( report.estimated_mesh_bytes, 900 );
+    EXPECT_EQ( report.contact_bytes, 600 );
+    EXPECT_EQ( report.estimated_dynamics_bytes, 150 );
+    EXPECT_EQ( report.adapter_bytes, 30 );
+    // Worlds are built one after the other, so the transient copy peaks at the largest one (not the sum)
+    EXPECT_EQ( report.hfield_build_copy_bytes, 2000 );
+
+    // Assets from both reports are merged, largest first
+    ASSERT_EQ( report.assets.size(), 4 );
+    EXPECT_EQ( report.assets[0].name, "box_asset_2" );
+    EXPECT_EQ( report.assets[1].name, "sphere_asset_2" );
+    EXPECT_EQ( report.assets[2].name, "box_asset_1" );
+    EXPECT_EQ( report.assets[3].name, "sphere_asset_1" );
+}
+
+TEST( TestLocoRaisimMemory, TestAggregateMemoryReports )
+{
+    std::vector<loco::raisimlib::TRaisimMemoryReport> reports;
+    for ( ssize_t i = 0; i < 20; i++ )
+        reports.push_back( CreateTestReport( 1, 1, i + 1 ) );
+
+    const auto aggregated_report = loco::raisimlib::AggregateMemoryReports( reports );
+    EXPECT_EQ( aggregated_report.num_worlds, 20 );
+    EXPECT_EQ( aggregated_report.num_objects_per_type.at( "box" ), 20 );
+    // sum of ( i + 1 ) for i in [0, 20) = 210
+    EXPECT_EQ( aggregated_report.object_bytes_per_type.at( "box" ), 100 * 210 );
+    EXPECT_EQ( aggregated_report.hfield_bytes, 1000 * 210 );
+    EXPECT_EQ( aggregated_report.hfield_build_copy_bytes, 1000 * 20 );
+
+    size_t total_bytes = 0;
+    for ( const auto& report : reports )
+        total_bytes += report.total_bytes();
+    EXPECT_EQ( aggregated_report.total_bytes(), total_bytes );
+
+    // Only the largest assets are kept
+    ASSERT_EQ( aggregated_report.assets.size(), loco::raisimlib::TRaisimMemoryReport::MAX_NUM_ASSETS );
+    EXPECT_EQ( aggregated_report.assets.front().bytes, 100 * 20 );
+    for ( ssize_t i = 1; i < aggregated_report.assets.size(); i++ )
+        EXPECT_GE( aggregated_report.assets[i - 1].bytes, aggregated_report.assets[i].bytes );
+
+    EXPECT_EQ( loco::raisimlib::AggregateMemoryReports( {} ).total_bytes(), 0 );
+}
@@ -0,0 +1,42 @@
+#include <loco_parallel_raisim.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+TEST( TestLocoRaisimParallel, TestThreadPoolRunsEveryTaskOnce )
+{
+    loco::raisimlib::TRaisimThreadPool thread_pool( 4 );
+    EXPECT_EQ( thread_pool.num_threads(), 4 );
+
+    // Several parallel-fors in a row (workers must pick up each new batch, and only once)
+    const ssize_t num_tasks = 1000;
+    std::vector<std::atomic<int>> counts( num_tasks );
+    for ( ssize_t iter = 0; iter < 50; iter++ )
+    {
+        for ( auto& count : counts )
+            count = 0;
+        thread_pool.ParallelFor( num_tasks, [&]( ssize_t i ) { counts[i]++; } );
+        for ( ssize_t i = 0; i < num_tasks; i++ )
+            ASSERT_EQ( counts[i].load(), 1 );
+    }
+
+    // Batches smaller than the pool, and empty ones
+    std::atomic<int> num_runs( 0 );
+    thread_pool.ParallelFor( 2, [&]( ssize_t i ) { num_runs++; } );
+    EXPECT_EQ( num_runs.load(), 2 );
+    thread_pool.ParallelFor( 0, [&]( ssize_t i ) { num_runs++; } );
+    EXPECT_EQ( num_runs.load(), 2 );
+}
+
+TEST( TestLocoRaisimParallel, TestThreadPoolSingleThreadRunsInOrder )
+{
+    loco::raisimlib::TRaisimThreadPool thread_pool( 1 );
+    EXPECT_EQ( thread_pool.num_threads(), 1 );
+
+    std::vector<ssize_t> order;
+    thread_pool.ParallelFor( 5, [&]( ssize_t i ) { order.push_back( i ); } );
+    EXPECT_EQ( order, std::vector<ssize_t>( { 0, 1, 2, 3, 4 } ) );
+
+    loco::raisimlib::TRaisimThreadPool thread_pool_hw( 0 );
+    EXPECT_GE( thread_pool_hw.num_threads(), 1 );
+}
@@ -0,0 +1,176 @@
+#include <loco_recorder_raisim.h>
+#include <loco_replayer_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+static const std::string TEST_RECORDING_FILEPATH = "./test_recorder_raisim.bin";
+
+// Writes a raw recording with a single kintree with the given dims, and no frames
+static void WriteKintreeRecording( const std::string& filepath, uint64_t num_gc, uint64_t num_gv, uint64_t num_kintree_values )
+{
+    auto header = loco::raisimlib::TRaisimRecordingHeader();
+    std::memset( static_cast<void*>( &header ), 0, sizeof( header ) );
+    std::memcpy( header.magic, loco::raisimlib::RAISIM_RECORDING_MAGIC, sizeof( header.magic ) );
+    header.version = loco::raisimlib::RAISIM_RECORDING_VERSION;
+    header.num_kintrees = 1;
+    header.num_kintree_values = num_kintree_values;
+    header.frame_bytes = sizeof( double ) * ( 1 + num_kintree_values );
+    header.names_offset = sizeof( header );
+    header.names_bytes = 8;
+    header.kintree_dims_offset = header.names_offset + header.names_bytes;
+    header.frames_offset = header.kintree_dims_offset + 2 * sizeof( uint64_t );
+    header.time_step = 0.01;
+
+    const uint64_t kintree_dims[2] = { num_gc, num_gv };
+    std::ofstream file( filepath, std::ios::binary | std::ios::trunc );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    file.write( "kintree\n", header.names_bytes );
+    file.write( reinterpret_cast<const char*>( kintree_dims ), sizeof( kintree_dims ) );
+}
+
+// Overwrites the given bytes of a file in-place
+static void PatchFile( const std::string& filepath, size_t offset, const void* data, size_t num_bytes )
+{
+    std::fstream file( filepath, std::ios::binary | std::ios::in | std::ios::out );
+    file.seekp( offset );
+    file.write( static_cast<const char*>( data ), num_bytes );
+}
+
+// Places the body at a state that's a function of the given time, so any frame can be checked on its own
+static void SetTimedState( raisim::SingleBodyObject* raisim_body, double time )
+{
+    raisim_body->setPosition( time, 2.0 * time, -time );
+    raisim_body->setOrientation( Eigen::Vector4d( 1.0, 0.0, 0.0, 0.0 ) );
+    raisim_body->setVelocity( 0.5 * time, 0.0, 1.0, 0.0, -time, 0.0 );
+}
+
+TEST( TestLocoRaisimRecorder, TestRawRecordReplayRoundTrip )
+{
+    auto raisim_world = std::make_unique<raisim::World>();
+    auto recorded_body = raisim_world->addSphere( 0.1, 1.0 );
+    auto replayed_body = raisim_world->addSphere( 0.1, 1.0 );
+
+    // Large enough ring for nothing to be dropped, and chunks smaller than the recording (so several get mapped)
+    const ssize_t num_frames = 200;
+    {
+        loco::raisimlib::TRaisimTrajectoryRecorder recorder( { { "ball", recorded_body } }, {}, nullptr, 0.01 );
+        ASSERT_TRUE( recorder.Start( TEST_RECORDING_FILEPATH, num_frames, 4096 ) );
+        for ( ssize_t i = 0; i < num_frames; i++ )
+        {
+            SetTimedState( recorded_body, 0.01 * i );
+            recorder.Record( 0.01 * i );
+        }
+        ASSERT_TRUE( recorder.Stop() );
+        EXPECT_EQ( recorder.num_frames_dropped(), 0 );
+        EXPECT_EQ( recorder.num_frames_written(), num_frames );
+    }
+
+    loco::raisimlib::TRaisimTrajectoryReplayer replayer;
+    ASSERT_TRUE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    EXPECT_EQ( replayer.codec(), loco::raisimlib::eRaisimRecordingCodec::RAW );
+    ASSERT_EQ( replayer.num_frames(), num_frames );
+    ASSERT_EQ( replayer.num_bodies(), 1 );
+    EXPECT_EQ( replayer.body_names()[0], "ball" );
+    EXPECT_NEAR( replayer.time_step(), 0.01, 1e-12 );
+    EXPECT_FALSE( replayer.BindBody( "missing", replayed_body ) );
+    ASSERT_TRUE( replayer.BindBody( "ball", replayed_body ) );
+
+    // Raw frames are stored as-is, so replaying them writes back exactly the recorded state
+    for ( ssize_t frame_index : { 0, 1, 137, 199, 42 } )
+    {
+        const double time = 0.01 * frame_index;
+        EXPECT_EQ( replayer.frame_time( frame_index ), time );
+        replayer.ApplyFrame( frame_index );
+        const auto& position = replayed_body->getPosition_W();
+        const auto& linear_vel = replayed_body->getLinearVelocity_W();
+        const auto& angular_vel = replayed_body->getAngularVelocity_W();
+        EXPECT_EQ( position[0], time );
+        EXPECT_EQ( position[1], 2.0 * time );
+        EXPECT_EQ( position[2], -time );
+        EXPECT_EQ( linear_vel[0], 0.5 * time );
+        EXPECT_EQ( linear_vel[2], 1.0 );
+        EXPECT_EQ( angular_vel[1], -time );
+    }
+    EXPECT_EQ( replayer.FindFrame( 0.555 ), 55 );
+    std::remove( TEST_RECORDING_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimRecorder, TestDroppedFramesWithTinyRing )
+{
+    auto raisim_world = std::make_unique<raisim::World>();
+    auto recorded_body = raisim_world->addSphere( 0.1, 1.0 );
+
+    // A single-frame ring filled much faster than the writer drains it (it sleeps while idle), so frames get
+    // dropped instead of blocking the caller
+    const ssize_t num_records = 20000;
+    int64_t num_written = 0, num_dropped = 0;
+    {
+        loco::raisimlib::TRaisimTrajectoryRecorder recorder( { { "ball", recorded_body } }, {}, nullptr, 0.01 );
+        ASSERT_TRUE( recorder.Start( TEST_RECORDING_FILEPATH, 1, 4096 ) );
+        for ( ssize_t i = 0; i < num_records; i++ )
+        {
+            SetTimedState( recorded_body, 0.01 * i );
+            recorder.Record( 0.01 * i );
+        }
+        ASSERT_TRUE( recorder.Stop() );
+        num_written = recorder.num_frames_written();
+        num_dropped = recorder.num_frames_dropped();
+    }
+    EXPECT_GT( num_dropped, 0 );
+    EXPECT_GT( num_written, 0 );
+    EXPECT_EQ( num_written + num_dropped, num_records );
+
+    // The frames that made it are complete (state consistent with their time) and in recording order
+    loco::raisimlib::TRaisimTrajectoryReplayer replayer;
+    ASSERT_TRUE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    ASSERT_EQ( replayer.num_frames(), num_written );
+    for ( ssize_t i = 0; i < replayer.num_frames(); i++ )
+    {
+        const double* frame = replayer.frame( i );
+        EXPECT_EQ( frame[1], frame[0] );
+        EXPECT_EQ( frame[2], 2.0 * frame[0] );
+        if ( i > 0 )
+            EXPECT_GT( frame[0], replayer.frame_time( i - 1 ) );
+    }
+    std::remove( TEST_RECORDING_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimRecorder, TestRejectsCorruptedLayouts )
+{
+    loco::raisimlib::TRaisimTrajectoryReplayer replayer;
+    WriteKintreeRecording( TEST_RECORDING_FILEPATH, 7, 6, 13 );
+    ASSERT_TRUE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    EXPECT_EQ( replayer.num_kintrees(), 1 );
+
+    // Dims of the kintrees that don't match the frame layout (including ones that would overflow when added up)
+    WriteKintreeRecording( TEST_RECORDING_FILEPATH, 7, 7, 13 );
+    EXPECT_FALSE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    WriteKintreeRecording( TEST_RECORDING_FILEPATH, 7, 5, 13 );
+    EXPECT_FALSE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    WriteKintreeRecording( TEST_RECORDING_FILEPATH, std::numeric_limits<uint64_t>::max(), 14, 13 );
+    EXPECT_FALSE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+
+    // Keyframes that point past the frames of a quantized recording
+    auto compression = loco::raisimlib::TRaisimRecordingCompression();
+    compression.codec = loco::raisimlib::eRaisimRecordingCodec::QUANTIZED;
+    compression.keyframe_interval = 4;
+    {
+        loco::raisimlib::TRaisimTrajectoryRecorder recorder( {}, {}, nullptr, 0.01 );
+        ASSERT_TRUE( recorder.Start( TEST_RECORDING_FILEPATH, 64, 4096, compression ) );
+        for ( ssize_t i = 0; i < 16; i++ )
+            recorder.Record( 0.01 * i );
+        ASSERT_TRUE( recorder.Stop() );
+    }
+    ASSERT_TRUE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    auto header = loco::raisimlib::TRaisimRecordingHeader();
+    std::ifstream( TEST_RECORDING_FILEPATH, std::ios::binary ).read( reinterpret_cast<char*>( &header ), sizeof( header ) );
+    ASSERT_EQ( header.num_keyframes, 4 );
+    const uint64_t bad_offset = header.frames_bytes;
+    PatchFile( TEST_RECORDING_FILEPATH, header.keyframes_offset + 2 * sizeof( uint64_t ), &bad_offset, sizeof( bad_offset ) );
+    EXPECT_FALSE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    std::remove( TEST_RECORDING_FILEPATH.c_str() );
+}
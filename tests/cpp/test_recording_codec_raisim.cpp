@@ -0,0 +1,141 @@
+#include <loco_recorder_raisim.h>
+#include <loco_replayer_raisim.h>
+#include <loco_recording_codec_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+static const std::string TEST_RECORDING_FILEPATH = "./test_recording_codec_raisim.bin";
+
+// Header of a quantized recording with the given number of bodies (no kintrees, nor contact-sensors)
+static loco::raisimlib::TRaisimRecordingHeader CreateTestHeader( ssize_t num_bodies )
+{
+    auto header = loco::raisimlib::TRaisimRecordingHeader();
+    header.num_bodies = num_bodies;
+    header.frame_bytes = sizeof( double ) * ( 1 + num_bodies * loco::raisimlib::RAISIM_RECORDING_BODY_DIM );
+    header.compression.codec = loco::raisimlib::eRaisimRecordingCodec::QUANTIZED;
+    return header;
+}
+
+// Fills a raw frame with random body states (unit quaternions, positions within a few meters)
+static void RandomFrame( std::mt19937& random_engine, double time, ssize_t num_bodies, double* dst_frame )
+{
+    auto uniform = std::uniform_real_distribution<double>( -1.0, 1.0 );
+    dst_frame[0] = time;
+    for ( ssize_t i = 0; i < num_bodies; i++ )
+    {
+        double* state = dst_frame + 1 + i * loco::raisimlib::RAISIM_RECORDING_BODY_DIM;
+        double quaternion_norm = 0.0;
+        for ( ssize_t j = 0; j < loco::raisimlib::RAISIM_RECORDING_BODY_DIM; j++ )
+            state[j] = 5.0 * uniform( random_engine );
+        for ( ssize_t j = 3; j < 7; j++ )
+            quaternion_norm += state[j] * state[j];
+        for ( ssize_t j = 3; j < 7; j++ )
+            state[j] /= std::sqrt( quaternion_norm );
+    }
+}
+
+TEST( TestLocoRaisimRecordingCodec, TestQuantizationErrorWithinResolution )
+{
+    const ssize_t num_bodies = 16;
+    const auto header = CreateTestHeader( num_bodies );
+    loco::raisimlib::TRaisimRecordingCodec codec( header, nullptr );
+    ASSERT_EQ( codec.num_values(), header.frame_bytes / sizeof( double ) );
+
+    auto random_engine = std::mt19937( 0 );
+    std::vector<double> frame( codec.num_values() ), decoded_frame( codec.num_values() );
+    std::vector<int64_t> values( codec.num_values() );
+    for ( ssize_t n = 0; n < 100; n++ )
+    {
+        RandomFrame( random_engine, 0.01 * n, num_bodies, frame.data() );
+        codec.Quantize( frame.data(), values.data() );
+        codec.Dequantize( values.data(), decoded_frame.data() );
+
+        EXPECT_NEAR( decoded_frame[0], frame[0], loco::raisimlib::RAISIM_RECORDING_TIME_RESOLUTION );
+        for ( ssize_t i = 0; i < num_bodies; i++ )
+        {
+            const double* state = frame.data() + 1 + i * loco::raisimlib::RAISIM_RECORDING_BODY_DIM;
+            const double* decoded_state = decoded_frame.data() + 1 + i * loco::raisimlib::RAISIM_RECORDING_BODY_DIM;
+            for ( ssize_t j = 0; j < 3; j++ )
+            {
+                EXPECT_NEAR( decoded_state[j], state[j], header.compression.position_resolution );
+                EXPECT_NEAR( decoded_state[7 + j], state[7 + j], header.compression.velocity_resolution );
+                EXPECT_NEAR( decoded_state[10 + j], state[10 + j], header.compression.velocity_resolution );
+            }
+            // Smallest-three may flip the sign of the quaternion (same rotation), so compare |<q, q'>| against 1
+            double dot = 0.0;
+            for ( ssize_t j = 3; j < 7; j++ )
+                dot += decoded_state[j] * state[j];
+            EXPECT_NEAR( std::abs( dot ), 1.0, 1e-6 );
+        }
+    }
+}
+
+TEST( TestLocoRaisimRecordingCodec, TestDeltaCodingIsLosslessAndCompact )
+{
+    const ssize_t num_bodies = 100;
+    const auto header = CreateTestHeader( num_bodies );
+    loco::raisimlib::TRaisimRecordingCodec codec( header, nullptr );
+
+    // Random keyframe, followed by frames where only the time and the first body change (the rest are at rest)
+    auto random_engine = std::mt19937( 1 );
+    std::vector<double> frame( codec.num_values() );
+    RandomFrame( random_engine, 0.0, num_bodies, frame.data() );
+    std::vector<std::vector<int64_t>> frames_values;
+    std::vector<uint8_t> bytes;
+    for ( ssize_t n = 0; n < 64; n++ )
+    {
+        frame[0] = 0.002 * n;
+        frame[1] += 0.001;
+        frames_values.push_back( std::vector<int64_t>( codec.num_values() ) );
+        codec.Quantize( frame.data(), frames_values.back().data() );
+        codec.Encode( frames_values.back().data(), n == 0 ? nullptr : frames_values[n - 1].data(), bytes );
+    }
+    EXPECT_LT( bytes.size() * 10, frames_values.size() * header.frame_bytes );
+
+    std::vector<int64_t> prev_values( codec.num_values() ), values( codec.num_values() );
+    const uint8_t* cursor = bytes.data();
+    for ( ssize_t n = 0; n < frames_values.size(); n++ )
+    {
+        cursor = codec.Decode( cursor, bytes.data() + bytes.size(), n == 0 ? nullptr : prev_values.data(), values.data() );
+        ASSERT_TRUE( cursor != nullptr );
+        EXPECT_EQ( values, frames_values[n] );
+        std::swap( values, prev_values );
+    }
+    EXPECT_EQ( cursor, bytes.data() + bytes.size() );
+
+    // Truncated streams are detected instead of read past their end
+    EXPECT_TRUE( codec.Decode( bytes.data(), bytes.data() + 4, nullptr, values.data() ) == nullptr );
+}
+
+TEST( TestLocoRaisimRecordingCodec, TestSeekQuantizedRecording )
+{
+    auto compression = loco::raisimlib::TRaisimRecordingCompression();
+    compression.codec = loco::raisimlib::eRaisimRecordingCodec::QUANTIZED;
+    compression.keyframe_interval = 16;
+
+    // Time-only recording (no bodies), where the ring is large enough to never drop frames
+    const ssize_t num_frames = 1000;
+    {
+        loco::raisimlib::TRaisimTrajectoryRecorder recorder( {}, {}, nullptr, 0.01 );
+        ASSERT_TRUE( recorder.Start( TEST_RECORDING_FILEPATH, num_frames, 4096, compression ) );
+        for ( ssize_t i = 0; i < num_frames; i++ )
+            recorder.Record( 0.01 * i );
+        ASSERT_TRUE( recorder.Stop() );
+        ASSERT_EQ( recorder.num_frames_dropped(), 0 );
+    }
+
+    loco::raisimlib::TRaisimTrajectoryReplayer replayer;
+    ASSERT_TRUE( replayer.Open( TEST_RECORDING_FILEPATH ) );
+    ASSERT_EQ( replayer.codec(), loco::raisimlib::eRaisimRecordingCodec::QUANTIZED );
+    ASSERT_EQ( replayer.num_frames(), num_frames );
+    // Random access (backwards, across blocks and within them) decodes the same frames as going in order
+    for ( ssize_t frame_index : { 999, 0, 17, 16, 15, 500, 501, 498 } )
+        EXPECT_NEAR( replayer.frame_time( frame_index ), 0.01 * frame_index, 1e-6 );
+    EXPECT_EQ( replayer.FindFrame( 1.234 ), 123 );
+    EXPECT_EQ( replayer.FindFrame( -1.0 ), 0 );
+    EXPECT_EQ( replayer.FindFrame( 1e6 ), num_frames - 1 );
+    std::remove( TEST_RECORDING_FILEPATH.c_str() );
+}
@@ -0,0 +1,274 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <loco_scene_file_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+static const std::string TEST_SCENE_FILEPATH = "./test_scene_file_raisim.bin";
+
+// Overwrites the given bytes of a file in-place
+static void PatchFile( const std::string& filepath, size_t offset, const void* data, size_t num_bytes )
+{
+    std::fstream file( filepath, std::ios::binary | std::ios::in | std::ios::out );
+    file.seekp( offset );
+    file.write( static_cast<const char*>( data ), num_bytes );
+}
+
+// Writes a scene file with a single record and the given payload (offsets in the record are up to the caller)
+static void WriteSingleRecordSceneFile( const std::string& filepath, const loco::raisimlib::TRaisimSceneBodyRecord& record,
+                                        const std::vector<uint8_t>& payload )
+{
+    auto header = loco::raisimlib::TRaisimSceneFileHeader();
+    std::memset( &header, 0, sizeof( header ) );
+    std::memcpy( header.magic, "LOCORSCN", sizeof( header.magic ) );
+    header.version = loco::raisimlib::RAISIM_SCENE_FILE_VERSION;
+    header.num_bodies = 1;
+    header.records_offset = sizeof( header );
+    header.payload_offset = header.records_offset + sizeof( record );
+    header.file_size = header.payload_offset + payload.size();
+
+    std::ofstream file( filepath, std::ios::binary | std::ios::trunc );
+    file.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+    file.write( reinterpret_cast<const char*>( &record ), sizeof( record ) );
+    file.write( reinterpret_cast<const char*>( payload.data() ), payload.size() );
+}
+
+// Record of a 1x1x1 box named "box" (the name being the first bytes of the payload)
+static loco::raisimlib::TRaisimSceneBodyRecord CreateBoxRecord( const loco::TShapeData& shape_data, const loco::TInertialData& inertia_data )
+{
+    auto record = loco::raisimlib::TRaisimSceneBodyRecord();
+    std::memset( &record, 0, sizeof( record ) );
+    record.name_offset = 0;
+    record.name_length = 3;
+    record.shape_type = (int32_t)loco::eShapeType::BOX;
+    record.dyntype = (int32_t)loco::eDynamicsType::STATIC;
+    record.source_hash = loco::raisimlib::ComputeSceneBodyHash( shape_data, inertia_data );
+    record.size[0] = record.size[1] = record.size[2] = 1.0;
+    record.mass = inertia_data.mass;
+    record.rotation[0] = record.rotation[4] = record.rotation[8] = 1.0;
+    return record;
+}
+
+static loco::TShapeData CreateBoxShape()
+{
+    auto shape_data = loco::TShapeData();
+    shape_data.type = loco::eShapeType::BOX;
+    shape_data.size = { 1.0, 1.0, 1.0 };
+    return shape_data;
+}
+
+// Scenario with a dynamic box, a dynamic mesh (tetrahedron) and a static heightfield
+static std::unique_ptr<loco::TScenario> CreateRoundTripScenario()
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+
+    auto box_data = loco::TBodyData();
+    box_data.dyntype = loco::eDynamicsType::DYNAMIC;
+    box_data.collision.type = loco::eShapeType::BOX;
+    box_data.collision.size = { 0.2, 0.4, 0.6 };
+    box_data.visual.type = loco::eShapeType::BOX;
+    box_data.visual.size = { 0.2, 0.4, 0.6 };
+    box_data.inertia.mass = 3.0;
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "box", box_data, tinymath::Vector3f( 1.0, 2.0, 3.0 ), tinymath::Matrix3f() ) );
+
+    auto mesh_data = loco::TBodyData();
+    mesh_data.dyntype = loco::eDynamicsType::DYNAMIC;
+    mesh_data.collision.type = loco::eShapeType::MESH;
+    mesh_data.collision.size = { 1.0, 1.0, 1.0 };
+    mesh_data.collision.mesh_data.vertices = { 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.5f };
+    mesh_data.collision.mesh_data.faces = { 0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3 };
+    mesh_data.visual.type = loco::eShapeType::MESH;
+    mesh_data.visual.size = { 1.0, 1.0, 1.0 };
+    mesh_data.inertia.mass = 0.5;
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "mesh", mesh_data, tinymath::Vector3f( -1.0, 0.0, 2.0 ), tinymath::Matrix3f() ) );
+
+    auto hfield_data = loco::TBodyData();
+    hfield_data.dyntype = loco::eDynamicsType::STATIC;
+    hfield_data.collision.type = loco::eShapeType::HFIELD;
+    hfield_data.collision.size = { 10.0, 8.0, 2.0 };
+    hfield_data.collision.hfield_data.nWidthSamples = 5;
+    hfield_data.collision.hfield_data.nDepthSamples = 4;
+    for ( ssize_t i = 0; i < 5 * 4; i++ )
+        hfield_data.collision.hfield_data.heights.push_back( 0.05f * ( i % 7 ) );
+    hfield_data.visual.type = loco::eShapeType::HFIELD;
+    hfield_data.visual.size = { 10.0, 8.0, 2.0 };
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "terrain", hfield_data, tinymath::Vector3f( 0.0, 0.0, 0.0 ), tinymath::Matrix3f() ) );
+    return scenario;
+}
+
+TEST( TestLocoRaisimSceneFile, TestSaveOpenBuildRoundTrip )
+{
+    // Cold build, preprocessing every body, then saved into a precompiled scene
+    auto cold_scenario = CreateRoundTripScenario();
+    auto cold_simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( cold_scenario.get() );
+    cold_simulation->Initialize();
+    ASSERT_TRUE( cold_simulation->SavePrecompiledScene( TEST_SCENE_FILEPATH ) );
+
+    // Same scenario, built from the precompiled scene. Records must still match the scenario (so they're used)
+    auto warm_scenario = CreateRoundTripScenario();
+    auto warm_simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( warm_scenario.get() );
+    ASSERT_TRUE( warm_simulation->LoadPrecompiledScene( TEST_SCENE_FILEPATH ) );
+    warm_simulation->Initialize();
+    loco::raisimlib::TRaisimSceneFile scene_file;
+    ASSERT_TRUE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    ASSERT_EQ( scene_file.num_bodies(), 3 );
+    for ( auto body : warm_scenario->GetSingleBodiesList() )
+    {
+        auto record = scene_file.FindBody( body->name() );
+        ASSERT_TRUE( record != nullptr );
+        EXPECT_EQ( record->source_hash, loco::raisimlib::ComputeSceneBodyHash( body->data().collision, body->data().inertia ) );
+    }
+
+    for ( const std::string& body_name : { "box", "mesh", "terrain" } )
+    {
+        auto cold_body = cold_simulation->GetSingleBodyAdapterByName( body_name )->raisim_body();
+        auto warm_body = warm_simulation->GetSingleBodyAdapterByName( body_name )->raisim_body();
+        ASSERT_TRUE( cold_body != nullptr );
+        ASSERT_TRUE( warm_body != nullptr );
+        EXPECT_EQ( warm_body->getBodyType(), cold_body->getBodyType() );
+        for ( ssize_t r = 0; r < 3; r++ )
+        {
+            EXPECT_NEAR( warm_body->getPosition_W()[r], cold_body->getPosition_W()[r], 1e-9 );
+            EXPECT_NEAR( warm_body->getLinearVelocity_W()[r], cold_body->getLinearVelocity_W()[r], 1e-9 );
+            EXPECT_NEAR( warm_body->getAngularVelocity_W()[r], cold_body->getAngularVelocity_W()[r], 1e-9 );
+            for ( ssize_t c = 0; c < 3; c++ )
+                EXPECT_NEAR( warm_body->getRotationMatrix()( r, c ), cold_body->getRotationMatrix()( r, c ), 1e-9 );
+        }
+        if ( body_name == "terrain" )
+            continue;
+        EXPECT_NEAR( warm_body->getMass( 0 ), cold_body->getMass( 0 ), 1e-9 );
+        for ( ssize_t r = 0; r < 3; r++ )
+            for ( ssize_t c = 0; c < 3; c++ )
+                EXPECT_NEAR( warm_body->getInertiaMatrix_B()( r, c ), cold_body->getInertiaMatrix_B()( r, c ), 1e-9 );
+    }
+
+    auto cold_hmap = static_cast<raisim::HeightMap*>( cold_simulation->GetSingleBodyAdapterByName( "terrain" )->raisim_body() );
+    auto warm_hmap = static_cast<raisim::HeightMap*>( warm_simulation->GetSingleBodyAdapterByName( "terrain" )->raisim_body() );
+    EXPECT_EQ( warm_hmap->getXSamples(), cold_hmap->getXSamples() );
+    EXPECT_EQ( warm_hmap->getYSamples(), cold_hmap->getYSamples() );
+    EXPECT_NEAR( warm_hmap->getXSize(), cold_hmap->getXSize(), 1e-9 );
+    EXPECT_NEAR( warm_hmap->getYSize(), cold_hmap->getYSize(), 1e-9 );
+    const auto& cold_heights = cold_hmap->getHeightMap();
+    const auto& warm_heights = warm_hmap->getHeightMap();
+    ASSERT_EQ( warm_heights.size(), cold_heights.size() );
+    for ( ssize_t i = 0; i < cold_heights.size(); i++ )
+        EXPECT_EQ( warm_heights[i], cold_heights[i] );
+    std::remove( TEST_SCENE_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimSceneFile, TestSaveAndOpenEmptyScene )
+{
+    ASSERT_TRUE( loco::raisimlib::TRaisimSceneFile::Save( TEST_SCENE_FILEPATH, {}, {} ) );
+
+    loco::raisimlib::TRaisimSceneFile scene_file;
+    ASSERT_TRUE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    EXPECT_EQ( scene_file.num_bodies(), 0 );
+    EXPECT_TRUE( scene_file.FindBody( "body_0" ) == nullptr );
+    std::remove( TEST_SCENE_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimSceneFile, TestRejectsOutdatedAndCorruptedFiles )
+{
+    loco::raisimlib::TRaisimSceneFile scene_file;
+    EXPECT_FALSE( scene_file.Open( "./missing_scene_file.bin" ) );
+
+    // Files saved with another version of the format must be recompiled
+    ASSERT_TRUE( loco::raisimlib::TRaisimSceneFile::Save( TEST_SCENE_FILEPATH, {}, {} ) );
+    const uint32_t old_version = loco::raisimlib::RAISIM_SCENE_FILE_VERSION + 1;
+    PatchFile( TEST_SCENE_FILEPATH, offsetof( loco::raisimlib::TRaisimSceneFileHeader, version ), &old_version, sizeof( old_version ) );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    EXPECT_FALSE( scene_file.is_open() );
+
+    // Headers that don't match the file (e.g. truncated on copy) are rejected
+    ASSERT_TRUE( loco::raisimlib::TRaisimSceneFile::Save( TEST_SCENE_FILEPATH, {}, {} ) );
+    const uint32_t num_bodies = 1000;
+    PatchFile( TEST_SCENE_FILEPATH, offsetof( loco::raisimlib::TRaisimSceneFileHeader, num_bodies ), &num_bodies, sizeof( num_bodies ) );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+
+    // Anything else isn't a scene at all
+    std::ofstream( TEST_SCENE_FILEPATH, std::ios::trunc ) << "definitely not a precompiled scene";
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    std::remove( TEST_SCENE_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimSceneFile, TestRejectsRecordsOutOfBounds )
+{
+    auto inertia_data = loco::TInertialData();
+    inertia_data.mass = 1.0;
+    const std::vector<uint8_t> payload = { 'b', 'o', 'x', 0, 0, 0, 0, 0 };
+    loco::raisimlib::TRaisimSceneFile scene_file;
+
+    auto record = CreateBoxRecord( CreateBoxShape(), inertia_data );
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, payload );
+    ASSERT_TRUE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    EXPECT_TRUE( scene_file.FindBody( "box" ) != nullptr );
+
+    // Names that run past the end of the file (including offsets that would overflow when added up)
+    record.name_length = payload.size() + 1;
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, payload );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    EXPECT_FALSE( scene_file.is_open() );
+    record.name_offset = std::numeric_limits<uint64_t>::max() - 1;
+    record.name_length = 3;
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, payload );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+
+    // Heightfields whose heights don't fit in the file
+    record = CreateBoxRecord( CreateBoxShape(), inertia_data );
+    record.shape_type = (int32_t)loco::eShapeType::HFIELD;
+    record.hfield_num_x = 2;
+    record.hfield_num_y = 2;
+    record.heights_offset = 8;
+    std::vector<uint8_t> hfield_payload( 8 + 4 * sizeof( double ), 0 );
+    std::memcpy( hfield_payload.data(), "box", 3 );
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, hfield_payload );
+    EXPECT_TRUE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    record.hfield_num_y = 3;
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, hfield_payload );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    record.hfield_num_x = uint64_t( 1 ) << 32;
+    record.hfield_num_y = uint64_t( 1 ) << 32;
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, record, hfield_payload );
+    EXPECT_FALSE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    std::remove( TEST_SCENE_FILEPATH.c_str() );
+}
+
+TEST( TestLocoRaisimSceneFile, TestOutdatedRecordsFallBack )
+{
+    auto inertia_data = loco::TInertialData();
+    inertia_data.mass = 1.0;
+    auto shape_data = CreateBoxShape();
+    const auto hash = loco::raisimlib::ComputeSceneBodyHash( shape_data, inertia_data );
+    EXPECT_EQ( hash, loco::raisimlib::ComputeSceneBodyHash( shape_data, inertia_data ) );
+
+    // Any change to the collider or inertial data changes the hash
+    auto heavier_inertia_data = inertia_data;
+    heavier_inertia_data.mass = 2.0;
+    EXPECT_NE( hash, loco::raisimlib::ComputeSceneBodyHash( shape_data, heavier_inertia_data ) );
+    auto larger_shape_data = shape_data;
+    larger_shape_data.size = { 1.0, 1.0, 2.0 };
+    EXPECT_NE( hash, loco::raisimlib::ComputeSceneBodyHash( larger_shape_data, inertia_data ) );
+    auto mesh_shape_data = shape_data;
+    mesh_shape_data.mesh_data.vertices = { 0.0f, 0.0f, 0.0f };
+    EXPECT_NE( hash, loco::raisimlib::ComputeSceneBodyHash( mesh_shape_data, inertia_data ) );
+
+    WriteSingleRecordSceneFile( TEST_SCENE_FILEPATH, CreateBoxRecord( shape_data, inertia_data ), { 'b', 'o', 'x', 0, 0, 0, 0, 0 } );
+    loco::raisimlib::TRaisimSceneFile scene_file;
+    ASSERT_TRUE( scene_file.Open( TEST_SCENE_FILEPATH ) );
+    auto record = scene_file.FindBody( "box" );
+    ASSERT_TRUE( record != nullptr );
+
+    // Records resolved from other data aren't used (callers build the body the usual way instead)
+    auto raisim_world = std::make_unique<raisim::World>();
+    EXPECT_TRUE( scene_file.CreateBody( raisim_world.get(), *record, shape_data, heavier_inertia_data ) == nullptr );
+    EXPECT_TRUE( scene_file.CreateBody( raisim_world.get(), *record, larger_shape_data, inertia_data ) == nullptr );
+    auto raisim_body = scene_file.CreateBody( raisim_world.get(), *record, shape_data, inertia_data );
+    ASSERT_TRUE( raisim_body != nullptr );
+    EXPECT_NEAR( raisim_body->getMass(), 1.0, 1e-6 );
+    std::remove( TEST_SCENE_FILEPATH.c_str() );
+}
@@ -0,0 +1,92 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+static loco::TBodyData CreateBoxData( const loco::eDynamicsType& dyntype )
+{
+    auto body_data = loco::TBodyData();
+    body_data.dyntype = dyntype;
+    body_data.collision.type = loco::eShapeType::BOX;
+    body_data.collision.size = { 0.2, 0.2, 0.2 };
+    body_data.visual.type = loco::eShapeType::BOX;
+    body_data.visual.size = { 0.2, 0.2, 0.2 };
+    return body_data;
+}
+
+TEST( TestLocoRaisimSingleBodyBatch, TestStatesOfMixedStaticAndDynamicBodies )
+{
+    // Static and dynamic bodies interleaved, so rows of the states buffers don't match the indices in the batch
+    auto scenario = std::make_unique<loco::TScenario>();
+    const std::vector<std::string> bodies_names = { "wall_0", "box_0", "wall_1", "box_1" };
+    for ( ssize_t i = 0; i < bodies_names.size(); i++ )
+    {
+        const auto dyntype = ( i % 2 == 0 ) ? loco::eDynamicsType::STATIC : loco::eDynamicsType::DYNAMIC;
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( bodies_names[i], CreateBoxData( dyntype ),
+                                                                      tinymath::Vector3f( 2.0 * i, 0.0, 1.0 + i ), tinymath::Matrix3f() ) );
+    }
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get(), true );
+    simulation->Initialize();
+    auto& batch = simulation->single_body_batch();
+    ASSERT_EQ( batch.num_bodies(), 4 );
+    ASSERT_EQ( batch.num_dynamic_bodies(), 2 );
+    for ( ssize_t i = 0; i < bodies_names.size(); i++ )
+        EXPECT_EQ( batch.body( i )->name(), bodies_names[i] );
+
+    // Only the dynamic bodies have rows (in registration order), with quaternions given as wxyz
+    const ssize_t state_dim = loco::raisimlib::TRaisimSingleBodyBatch::STATE_DIM;
+    std::vector<double> states( batch.num_dynamic_bodies() * state_dim, -1.0 );
+    batch.GetStates( states.data() );
+    for ( ssize_t row = 0; row < batch.num_dynamic_bodies(); row++ )
+    {
+        const ssize_t index = 2 * row + 1;
+        const double* state = states.data() + row * state_dim;
+        EXPECT_NEAR( state[0], 2.0 * index, 1e-6 );
+        EXPECT_NEAR( state[1], 0.0, 1e-6 );
+        EXPECT_NEAR( state[2], 1.0 + index, 1e-6 );
+        EXPECT_NEAR( state[3], 1.0, 1e-6 );
+        for ( ssize_t j = 4; j < state_dim; j++ )
+            EXPECT_NEAR( state[j], 0.0, 1e-6 );
+    }
+
+    // Rotated 90deg about z (wxyz), moved and set in motion. Static bodies aren't touched
+    const double half_sqrt2 = std::sqrt( 0.5 );
+    std::vector<double> new_states = { 1.0, 2.0, 3.0, half_sqrt2, 0.0, 0.0, half_sqrt2, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6,
+                                       -1.0, -2.0, 5.0, 1.0, 0.0, 0.0, 0.0, -0.1, -0.2, -0.3, -0.4, -0.5, -0.6 };
+    ASSERT_EQ( new_states.size(), states.size() );
+    batch.SetStates( new_states.data() );
+    batch.GetStates( states.data() );
+    for ( ssize_t j = 0; j < states.size(); j++ )
+        EXPECT_NEAR( states[j], new_states[j], 1e-9 );
+
+    const auto rotated_body = batch.raisim_body( 1 );
+    EXPECT_NEAR( rotated_body->getPosition_W()[0], 1.0, 1e-9 );
+    const Eigen::Matrix3d rotation = rotated_body->getRotationMatrix();
+    EXPECT_NEAR( rotation( 0, 1 ), -1.0, 1e-9 );
+    EXPECT_NEAR( rotation( 1, 0 ), 1.0, 1e-9 );
+    EXPECT_NEAR( batch.raisim_body( 3 )->getPosition_W()[2], 5.0, 1e-9 );
+    for ( ssize_t index : { 0, 2 } )
+    {
+        EXPECT_NEAR( batch.raisim_body( index )->getPosition_W()[0], 2.0 * index, 1e-9 );
+        EXPECT_NEAR( batch.raisim_body( index )->getPosition_W()[2], 1.0 + index, 1e-9 );
+    }
+
+    // Resetting places the dynamic bodies back at their tf0, at rest (their initial velocities)
+    for ( ssize_t i = 0; i < 5; i++ )
+        simulation->Step();
+    simulation->Reset();
+    batch.GetStates( states.data() );
+    for ( ssize_t row = 0; row < batch.num_dynamic_bodies(); row++ )
+    {
+        const ssize_t index = 2 * row + 1;
+        const double* state = states.data() + row * state_dim;
+        EXPECT_NEAR( state[0], 2.0 * index, 1e-9 );
+        EXPECT_NEAR( state[1], 0.0, 1e-9 );
+        EXPECT_NEAR( state[2], 1.0 + index, 1e-9 );
+        EXPECT_NEAR( state[3], 1.0, 1e-9 );
+        for ( ssize_t j = 4; j < state_dim; j++ )
+            EXPECT_NEAR( state[j], 0.0, 1e-9 );
+    }
+}
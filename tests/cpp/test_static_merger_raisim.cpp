@@ -0,0 +1,112 @@
+#include <loco.h>
+#include <loco_simulation_raisim.h>
+#include <gtest/gtest.h>
+
+static loco::TBodyData CreateWallData()
+{
+    auto body_data = loco::TBodyData();
+    body_data.dyntype = loco::eDynamicsType::STATIC;
+    body_data.collision.type = loco::eShapeType::BOX;
+    body_data.collision.size = { 1.0, 0.1, 0.5 };
+    body_data.visual.type = loco::eShapeType::BOX;
+    body_data.visual.size = { 1.0, 0.1, 0.5 };
+    return body_data;
+}
+
+TEST( TestLocoRaisimStaticMerger, TestMergedStaticBodiesQueryAndReset )
+{
+    auto scenario = std::make_unique<loco::TScenario>();
+    const std::vector<std::string> walls_names = { "wall_0", "wall_1" };
+    for ( ssize_t i = 0; i < walls_names.size(); i++ )
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( walls_names[i], CreateWallData(),
+                                                                      tinymath::Vector3f( 2.0 * i, 1.0, 0.25 ), tinymath::Matrix3f() ) );
+    auto ball_data = loco::TBodyData();
+    ball_data.dyntype = loco::eDynamicsType::DYNAMIC;
+    ball_data.collision.type = loco::eShapeType::SPHERE;
+    ball_data.collision.size = { 0.1, 0.1, 0.1 };
+    ball_data.visual.type = loco::eShapeType::SPHERE;
+    ball_data.visual.size = { 0.1, 0.1, 0.1 };
+    scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "ball", ball_data, tinymath::Vector3f( 0.0, 0.0, 1.0 ), tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get(), false, true );
+    simulation->Initialize();
+    ASSERT_EQ( simulation->static_merger().num_bodies(), 2 );
+
+    // Merged bodies have no adapter (so loco-side calls on them never reach a null raisim object), but can be
+    // queried through their merged compound
+    auto wall_body = scenario->GetSingleBodiesList()[1];
+    EXPECT_TRUE( simulation->GetSingleBodyAdapterByName( "wall_1" ) == nullptr );
+    EXPECT_TRUE( simulation->GetSingleBodyAdapterByName( "ball" ) != nullptr );
+    EXPECT_EQ( simulation->AddContactSensor( "wall_1" ), -1 );
+    ssize_t child_index = -1;
+    auto merged_compound = simulation->GetMergedStaticCompound( "wall_1", &child_index );
+    ASSERT_TRUE( merged_compound != nullptr );
+    ASSERT_GE( child_index, 0 );
+    const auto& children = merged_compound->getObjList();
+    ASSERT_LT( child_index, children.size() );
+    const Eigen::Vector3d compound_position = merged_compound->getPosition();
+    EXPECT_NEAR( compound_position.x() + children[child_index].trans.pos[0], 2.0, 1e-5 );
+    EXPECT_NEAR( compound_position.y() + children[child_index].trans.pos[1], 1.0, 1e-5 );
+    EXPECT_NEAR( compound_position.z() + children[child_index].trans.pos[2], 0.25, 1e-5 );
+
+    // Setting the pose of a merged body only changes the loco-side body, and stepping|resetting leaves the merged
+    // compound where it was built
+    wall_body->SetPosition( loco::TVec3( 5.0, 5.0, 5.0 ) );
+    for ( ssize_t i = 0; i < 10; i++ )
+        simulation->Step();
+    simulation->Reset();
+    EXPECT_NEAR( merged_compound->getPosition().x(), compound_position.x(), 1e-6 );
+    EXPECT_NEAR( merged_compound->getPosition().z(), compound_position.z(), 1e-6 );
+
+    // The dynamic ball is still handled through its adapter
+    loco::TMat4 ball_transform;
+    simulation->GetSingleBodyAdapterByName( "ball" )->GetTransform( ball_transform );
+    EXPECT_NEAR( ball_transform( 2, 3 ), 1.0, 1e-5 );
+}
+
+TEST( TestLocoRaisimStaticMerger, TestBodiesAreGroupedByCell )
+{
+    // Default cells are 10m wide: walls 0|1 share cell (0,0), and the others are alone in cells (1,0), (-1,0), (0,2)
+    auto scenario = std::make_unique<loco::TScenario>();
+    const std::vector<loco::TVec3> walls_positions = { { 1.0, 1.0, 0.25 }, { 3.0, 8.0, 0.25 }, { 12.0, 1.0, 0.25 },
+                                                       { -5.0, 1.0, 0.25 }, { 1.0, 25.0, 0.25 } };
+    for ( ssize_t i = 0; i < walls_positions.size(); i++ )
+        scenario->AddSingleBody( std::make_unique<loco::TSingleBody>( "wall_" + std::to_string( i ), CreateWallData(),
+                                                                      walls_positions[i], tinymath::Matrix3f() ) );
+
+    auto simulation = std::make_unique<loco::raisimlib::TRaisimSimulation>( scenario.get(), false, true );
+    simulation->Initialize();
+    const auto& static_merger = simulation->static_merger();
+    ASSERT_EQ( static_merger.num_bodies(), walls_positions.size() );
+    ASSERT_EQ( static_merger.groups().size(), 4 );
+
+    EXPECT_EQ( static_merger.raisim_compound( 0 ), static_merger.raisim_compound( 1 ) );
+    EXPECT_NE( static_merger.child_index( 0 ), static_merger.child_index( 1 ) );
+    for ( ssize_t i = 1; i < walls_positions.size(); i++ )
+        for ( ssize_t j = i + 1; j < walls_positions.size(); j++ )
+            EXPECT_NE( static_merger.raisim_compound( i ), static_merger.raisim_compound( j ) );
+
+    // Each (compound, child) pair maps back to the body it was created from, placed where that body is
+    for ( ssize_t i = 0; i < walls_positions.size(); i++ )
+    {
+        auto merged_compound = static_merger.raisim_compound( i );
+        const ssize_t child_index = static_merger.child_index( i );
+        EXPECT_EQ( static_merger.FindBody( "wall_" + std::to_string( i ) ), i );
+        EXPECT_EQ( static_merger.FindBody( merged_compound, child_index ), i );
+        EXPECT_EQ( static_merger.body( i )->name(), "wall_" + std::to_string( i ) );
+
+        const auto& children = merged_compound->getObjList();
+        ASSERT_LT( child_index, children.size() );
+        const Eigen::Vector3d compound_position = merged_compound->getPosition();
+        EXPECT_NEAR( compound_position.x() + children[child_index].trans.pos[0], walls_positions[i].x(), 1e-5 );
+        EXPECT_NEAR( compound_position.y() + children[child_index].trans.pos[1], walls_positions[i].y(), 1e-5 );
+        EXPECT_NEAR( compound_position.z() + children[child_index].trans.pos[2], walls_positions[i].z(), 1e-5 );
+    }
+
+    // Children out of range, and objects that aren't merged compounds, map to no body
+    EXPECT_EQ( static_merger.FindBody( static_merger.raisim_compound( 2 ), 1 ), -1 );
+    EXPECT_EQ( static_merger.FindBody( static_merger.raisim_compound( 2 ), -1 ), -1 );
+    auto raisim_sphere = simulation->raisim_world()->addSphere( 0.1, 1.0 );
+    EXPECT_EQ( static_merger.FindBody( raisim_sphere, 0 ), -1 );
+    EXPECT_EQ( static_merger.FindBody( "missing" ), -1 );
+}
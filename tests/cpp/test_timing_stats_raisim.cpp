@@ -0,0 +1,54 @@
+#include <loco_profiling_raisim.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+TEST( TestLocoRaisimTimingStats, TestTimingStatsPercentiles )
+{
+    loco::raisimlib::TRaisimTimingAccumulator accumulator;
+    auto stats = accumulator.stats();
+    EXPECT_EQ( stats.count, 0 );
+    EXPECT_DOUBLE_EQ( stats.mean, 0.0 );
+    EXPECT_DOUBLE_EQ( stats.p99, 0.0 );
+
+    // Uniform samples in [1, 100000]ns, so percentiles are known in closed form
+    std::mt19937 rng( 0 );
+    std::uniform_int_distribution<int64_t> dist( 1, 100000 );
+    const ssize_t num_samples = 200000;
+    double total = 0.0;
+    int64_t max_sample = 0;
+    for ( ssize_t i = 0; i < num_samples; i++ )
+    {
+        const int64_t sample = dist( rng );
+        accumulator.AddSample( sample );
+        total += sample;
+        max_sample = std::max( max_sample, sample );
+    }
+
+    stats = accumulator.stats();
+    EXPECT_EQ( stats.count, num_samples );
+    EXPECT_NEAR( stats.mean, total / num_samples, 1e-6 );
+    EXPECT_DOUBLE_EQ( stats.max, max_sample );
+    EXPECT_NEAR( stats.p50, 50000.0, 0.05 * 50000.0 );
+    EXPECT_NEAR( stats.p99, 99000.0, 0.05 * 99000.0 );
+    EXPECT_LE( stats.p99, stats.max );
+
+    accumulator.Reset();
+    stats = accumulator.stats();
+    EXPECT_EQ( stats.count, 0 );
+    EXPECT_DOUBLE_EQ( stats.max, 0.0 );
+}
+
+TEST( TestLocoRaisimTimingStats, TestTimingStatsSmallSamplesAreExact )
+{
+    loco::raisimlib::TRaisimTimingAccumulator accumulator;
+    for ( int64_t sample : { 3, 3, 3, 7, 9 } )
+        accumulator.AddSample( sample );
+
+    const auto stats = accumulator.stats();
+    EXPECT_EQ( stats.count, 5 );
+    EXPECT_DOUBLE_EQ( stats.mean, 5.0 );
+    EXPECT_DOUBLE_EQ( stats.p50, 3.0 );
+    EXPECT_DOUBLE_EQ( stats.p99, 9.0 );
+    EXPECT_DOUBLE_EQ( stats.max, 9.0 );
+}
@@ -0,0 +1,87 @@
+#include <loco_trace_raisim.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+static const char* TEST_EVENT_NAMES[] = { "event_0", "event_1", "event_2", "event_3", "event_4",
+                                          "event_5", "event_6", "event_7", "event_8", "event_9" };
+
+// Number of times the given substring appears in the given string
+static ssize_t CountOccurrences( const std::string& str, const std::string& substr )
+{
+    ssize_t count = 0;
+    for ( size_t pos = str.find( substr ); pos != std::string::npos; pos = str.find( substr, pos + substr.size() ) )
+        count++;
+    return count;
+}
+
+TEST( TestLocoRaisimTrace, TestChromeTraceJson )
+{
+    auto& recorder = loco::raisimlib::TRaisimTraceRecorder::GetInstance();
+    recorder.Clear();
+    // Buffers are sized when a thread first records, so each case records from its own thread
+    recorder.Enable( 4 );
+
+    std::thread( [&]() {
+        for ( ssize_t i = 0; i < 2; i++ )
+            recorder.Record( TEST_EVENT_NAMES[i], nullptr, 1000 * i, 500 );
+    } ).join();
+    std::string json = recorder.ToChromeTraceJson();
+    EXPECT_EQ( json.find( "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" ), 0 );
+    EXPECT_NE( json.find( "\"name\":\"event_0\",\"ph\":\"X\"" ), std::string::npos );
+    EXPECT_NE( json.find( "\"name\":\"event_1\",\"ph\":\"X\"" ), std::string::npos );
+    // Timestamps are written in microseconds
+    EXPECT_NE( json.find( "\"ts\":1.000,\"dur\":0.500" ), std::string::npos );
+    EXPECT_EQ( CountOccurrences( json, "\"ph\":\"M\"" ), CountOccurrences( json, "thread_name" ) );
+
+    // Once wrapped, only the last (capacity - 1) events are dumped, as the oldest slot is the next one written
+    recorder.Clear();
+    std::thread( [&]() {
+        for ( ssize_t i = 0; i < 10; i++ )
+            recorder.Record( TEST_EVENT_NAMES[i], nullptr, 1000 * i, 500 );
+    } ).join();
+    json = recorder.ToChromeTraceJson();
+    for ( ssize_t i = 0; i < 7; i++ )
+        EXPECT_EQ( json.find( std::string( "\"name\":\"" ) + TEST_EVENT_NAMES[i] + "\"" ), std::string::npos );
+    for ( ssize_t i = 7; i < 10; i++ )
+        EXPECT_NE( json.find( std::string( "\"name\":\"" ) + TEST_EVENT_NAMES[i] + "\"" ), std::string::npos );
+    EXPECT_EQ( json.substr( json.size() - 4 ), "\n]}\n" );
+
+    recorder.Disable();
+    recorder.Clear();
+}
+
+TEST( TestLocoRaisimTrace, TestDumpWhileRecording )
+{
+    auto& recorder = loco::raisimlib::TRaisimTraceRecorder::GetInstance();
+    recorder.Clear();
+    recorder.Enable( 8 );
+
+    // The writer keeps begin == duration, so a torn (partially overwritten) event would show up in the dump
+    std::atomic<bool> stop( false );
+    std::thread writer( [&]() {
+        for ( int64_t i = 1; !stop.load(); i++ )
+            recorder.Record( "concurrent", nullptr, 1000 * i, 1000 * i );
+    } );
+
+    for ( ssize_t dump = 0; dump < 200; dump++ )
+    {
+        const std::string json = recorder.ToChromeTraceJson();
+        const std::string ts_key = "\"ts\":", dur_key = ",\"dur\":";
+        for ( size_t pos = json.find( ts_key ); pos != std::string::npos; pos = json.find( ts_key, pos + 1 ) )
+        {
+            const size_t ts_begin = pos + ts_key.size();
+            const size_t dur_pos = json.find( dur_key, ts_begin );
+            const size_t dur_begin = dur_pos + dur_key.size();
+            const std::string ts = json.substr( ts_begin, dur_pos - ts_begin );
+            const std::string dur = json.substr( dur_begin, json.find( ',', dur_begin ) - dur_begin );
+            ASSERT_EQ( ts, dur );
+        }
+    }
+
+    stop = true;
+    writer.join();
+    recorder.Disable();
+    recorder.Clear();
+}
@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+
+import loco
+import loco_raisim
+import numpy as np
+import gc
+
+def create_scenario() :
+    col_data = loco.sim.CollisionData()
+    col_data.type = loco.sim.ShapeType.BOX
+    col_data.size = [ 0.2, 0.2, 0.2 ]
+    vis_data = loco.sim.VisualData()
+    vis_data.type = loco.sim.ShapeType.BOX
+    vis_data.size = [ 0.2, 0.2, 0.2 ]
+
+    body_data = loco.sim.BodyData()
+    body_data.dyntype = loco.sim.DynamicsType.DYNAMIC
+    body_data.collision = col_data
+    body_data.visual = vis_data
+
+    scenario = loco.sim.Scenario()
+    scenario.AddSingleBody( loco.sim.SingleBody( 'body_0', body_data, [ 0.0, 0.0, 1.0 ], np.identity( 3 ) ) )
+    return scenario
+
+def test_vectorized_raisim_backend() :
+    num_worlds = 8
+    scenarios = [ create_scenario() for _ in range( num_worlds ) ]
+    vec_simulation = loco_raisim.VectorizedSimulation( scenarios, num_threads=4 )
+    assert ( vec_simulation.num_worlds == num_worlds )
+    assert ( vec_simulation.observation_dim == 13 )
+    assert ( vec_simulation.action_dim == 0 )
+
+    observations_0 = vec_simulation.Reset().copy()
+    assert ( observations_0.shape == ( num_worlds, 13 ) )
+    assert ( np.allclose( observations_0[:, 2], 1.0 ) )
+
+    for _ in range( 10 ) :
+        observations, dones = vec_simulation.Step( np.zeros( ( num_worlds, 0 ) ) )
+    # All worlds are identical, so all boxes should have fallen the same amount
+    assert ( np.all( observations[:, 2] < 1.0 ) )
+    assert ( np.allclose( observations[:, 2], observations[0, 2] ) )
+    assert ( dones.dtype == np.bool_ and not np.any( dones ) )
+
+    observations = vec_simulation.Reset()
+    assert ( np.allclose( observations, observations_0 ) )
+
+    del vec_simulation
+    gc.collect()
+
+def test_vectorized_raisim_auto_reset() :
+    num_worlds = 4
+    scenarios = [ create_scenario() for _ in range( num_worlds ) ]
+    vec_simulation = loco_raisim.VectorizedSimulation( scenarios, num_threads=2 )
+    assert ( vec_simulation.AddTerminationCondition( loco_raisim.TerminationType.TIME_LIMIT, threshold=5 ) )
+    assert ( vec_simulation.AddTerminationCondition( loco_raisim.TerminationType.BODY_BELOW_HEIGHT, 'body_0', 0.5 ) )
+    assert ( not vec_simulation.AddTerminationCondition( loco_raisim.TerminationType.BODY_BELOW_HEIGHT, 'body_x', 0.5 ) )
+    observations_0 = vec_simulation.Reset().copy()
+
+    for i in range( 5 ) :
+        observations, dones = vec_simulation.Step()
+        assert ( np.all( dones ) == ( i == 4 ) )
+    # Terminated worlds start again from the snapshot, and keep the state they were terminated at
+    assert ( np.allclose( observations, observations_0 ) )
+    assert ( np.all( vec_simulation.terminal_observations[:, 2] < 1.0 ) )
+    assert ( np.all( vec_simulation.episode_steps == 0 ) )
+
+    del vec_simulation
+    gc.collect()
+
+if __name__ == '__main__' :
+    _ = input( 'Press ENTER to start test : test_vectorized_raisim_backend' )
+    test_vectorized_raisim_backend()
+    test_vectorized_raisim_auto_reset()
+
+    _ = input( 'Press ENTER to continue ...' )